@@ -0,0 +1,261 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include <cstring>
+
+#include "rsadriver.hpp"
+#include "sha3driver.hpp"
+#include "aes.hpp"
+#include "utils.hpp"
+
+// Untimed runs before measuring (fills caches, wakes up the cores)
+#define WARMUP_RUNS 3
+
+// Default number of timed runs per benchmark
+#define DEFAULT_RUNS 30
+
+// Number of register accesses per MMIO sample
+#define MMIO_BATCH 1024
+
+typedef std::chrono::steady_clock bench_clock;
+
+struct BenchResult {
+    std::string name;
+    size_t bytes;          // Bytes processed per run (0 if not a throughput benchmark)
+    std::vector<double> samples; // Duration of each run (microseconds)
+};
+
+// Returns the given percentile of sorted samples (nearest rank)
+double percentile(const std::vector<double>& sorted, double p) {
+    size_t rank = (size_t)(p / 100.0 * sorted.size() + 0.5);
+    if (rank < 1)
+        rank = 1;
+    if (rank > sorted.size())
+        rank = sorted.size();
+
+    return sorted[rank - 1];
+}
+
+void print_header() {
+    std::cout << std::left << std::setw(32) << "benchmark"
+              << std::right << std::setw(8) << "runs"
+              << std::setw(14) << "median (us)"
+              << std::setw(14) << "p99 (us)"
+              << std::setw(12) << "MB/s" << std::endl;
+}
+
+void print_result(const BenchResult& result) {
+    std::vector<double> sorted = result.samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    const double median = percentile(sorted, 50);
+    const double p99 = percentile(sorted, 99);
+
+    std::cout << std::left << std::setw(32) << result.name
+              << std::right << std::setw(8) << sorted.size()
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << median
+              << std::setw(14) << p99;
+
+    // Throughput at the median (bytes per microsecond == MB/s)
+    if (result.bytes > 0 && median > 0)
+        std::cout << std::setw(12) << result.bytes / median;
+    else
+        std::cout << std::setw(12) << "-";
+
+    std::cout << std::endl;
+}
+
+// Runs one benchmark if its name contains the filter string
+void bench(const std::string& name, size_t bytes, int runs, const std::string& filter,
+           const std::function<void()>& body) {
+    if (name.find(filter) == std::string::npos)
+        return;
+
+    BenchResult result;
+    result.name = name;
+    result.bytes = bytes;
+    result.samples.reserve(runs);
+
+    for (int i = 0; i < WARMUP_RUNS; i++)
+        body();
+
+    for (int i = 0; i < runs; i++) {
+        const auto start = bench_clock::now();
+        body();
+        const auto end = bench_clock::now();
+
+        result.samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    print_result(result);
+}
+
+std::string random_data(size_t size) {
+    std::string data (size, 0);
+    for (size_t i = 0; i < size; i++)
+        data[i] = (char)(std::rand() & 0xFF);
+    return data;
+}
+
+// Returns a random odd RSA-512 modulus (hex, top bit set) for the software
+// encryption path, whose cost doesn't depend on the modulus
+std::string random_modulus() {
+    const char* digits = "0123456789abcdef";
+    std::string modulus (2 * RSA_CHUNK_SIZE, '0');
+
+    for (size_t i = 0; i < modulus.size(); i++)
+        modulus[i] = digits[std::rand() & 0xF];
+
+    modulus.front() = digits[8 + (std::rand() & 0x7)];
+    modulus.back() = digits[1 + 2 * (std::rand() & 0x7)];
+
+    return modulus;
+}
+
+std::string size_name(size_t size) {
+    if (size >= 1048576)
+        return std::to_string(size / 1048576) + " MB";
+    if (size >= 1024)
+        return std::to_string(size / 1024) + " KB";
+    return std::to_string(size) + " B";
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "-h") {
+        std::cout << "Usage: bench [runs] [filter]" << std::endl;
+        return 0;
+    }
+
+    const int runs = (argc > 1) ? std::atoi(argv[1]) : DEFAULT_RUNS;
+    const std::string filter = (argc > 2) ? argv[2] : "";
+
+    if (runs < 1) {
+        std::cout << "Number of runs must be positive" << std::endl;
+        return 1;
+    }
+
+    std::srand(0);
+
+    RSADriver rsa;
+    SHA3Driver sha3;
+
+    #ifdef AXI_SIMULATION
+        std::cout << "Running against the simulated cores" << std::endl;
+    #endif
+
+    print_header();
+
+    // MMIO latency: batches of status register reads and harmless writes
+    bench("MMIO read x" + std::to_string(MMIO_BATCH), 0, runs, filter, [&]() {
+        for (int i = 0; i < MMIO_BATCH; i++)
+            sha3.read(HASH_READY_OFFSET);
+    });
+
+    bench("MMIO write x" + std::to_string(MMIO_BATCH), 0, runs, filter, [&]() {
+        for (int i = 0; i < MMIO_BATCH; i++)
+            sha3.write(SHA3_RESET_OFFSET, 0x0);
+    });
+
+    // Marshalling: byte swapping a buffer word by word as the drivers do
+    {
+        const std::string data = random_data(1048576);
+        std::vector<uint32_t> words (data.size() / 4);
+
+        bench("Byte swap 1 MB", data.size(), runs, filter, [&]() {
+            const uint8_t* ptr = reinterpret_cast<const uint8_t *>(data.data());
+            uint32_t value;
+
+            for (size_t i = 0; i < words.size(); i++) {
+                std::memcpy(&value, ptr + 4 * i, 4);
+                words[i] = swap_bytes(value);
+            }
+        });
+    }
+
+    // SHA-3 throughput by input size
+    const size_t hash_sizes[] = {64, 1024, 65536, 1048576};
+
+    for (const size_t size : hash_sizes) {
+        const std::string data = random_data(size);
+
+        bench("SHA3 " + size_name(size), size, runs, filter, [&]() {
+            sha3.begin();
+            sha3.update(data.data(), data.size());
+            sha3.finalize(false);
+        });
+    }
+
+    // RSA per chunk and in bulk
+    {
+        const std::string chunk = random_data(PKCS1_CHUNK_SIZE - 1);
+        const std::string bulk = random_data(65536);
+
+        const std::string chunk_ciphertext = rsa.encrypt(chunk, RSAKey::D_PUB);
+        const std::string bulk_ciphertext = rsa.encrypt(bulk, RSAKey::D_PUB);
+
+        bench("RSA encrypt chunk", chunk.size(), runs, filter, [&]() {
+            rsa.encrypt(chunk, RSAKey::GU_PUB);
+        });
+
+        bench("RSA decrypt chunk", chunk_ciphertext.size(), runs, filter, [&]() {
+            rsa.decrypt(chunk_ciphertext);
+        });
+
+        bench("RSA encrypt 64 KB", bulk.size(), runs, filter, [&]() {
+            rsa.encrypt(bulk, RSAKey::GU_PUB);
+        });
+
+        bench("RSA decrypt 64 KB", bulk_ciphertext.size(), runs, filter, [&]() {
+            rsa.decrypt(bulk_ciphertext);
+        });
+
+        // With a modulus set (pubkey in updater.conf), encryption to the slot runs in software
+        RSADriver::set_public_key(RSAKey::GU_PUB, random_modulus());
+
+        bench("RSA encrypt chunk (software)", chunk.size(), runs, filter, [&]() {
+            rsa.encrypt(chunk, RSAKey::GU_PUB);
+        });
+
+        bench("RSA encrypt 64 KB (software)", bulk.size(), runs, filter, [&]() {
+            rsa.encrypt(bulk, RSAKey::GU_PUB);
+        });
+    }
+
+    // End-to-end: decrypt an image body and hash the plaintext, as the client does
+    {
+        const std::string body = random_data(262144);
+        const std::string rsa_image = rsa.encrypt(body, RSAKey::D_PUB);
+
+        bench("Image RSA decrypt+hash 256 KB", body.size(), runs, filter, [&]() {
+            const std::string plaintext = rsa.decrypt(rsa_image);
+            sha3.begin();
+            sha3.update(plaintext.data(), plaintext.size());
+            sha3.finalize(false);
+        });
+
+        const uint8_t key[AES_KEY_SIZE] = {0};
+        const uint8_t nonce[AES_NONCE_SIZE] = {0};
+        std::string aes_image = body;
+
+        bench("Image AES decrypt+hash 256 KB", body.size(), runs, filter, [&]() {
+            AESCTR aes (key, nonce);
+            aes.apply(reinterpret_cast<uint8_t *>(&aes_image[0]), aes_image.size());
+            sha3.begin();
+            sha3.update(aes_image.data(), aes_image.size());
+            sha3.finalize(false);
+        });
+    }
+
+    std::cout << std::endl;
+    RSADriver::counters.print(std::cout);
+    RSADriver::software_counters.print(std::cout);
+    SHA3Driver::counters.print(std::cout);
+
+    return 0;
+}
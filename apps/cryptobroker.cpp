@@ -0,0 +1,30 @@
+#include <iostream>
+#include <csignal>
+
+#include "broker.hpp"
+
+// Owns the RSA and SHA-3 cores for as long as it runs
+CryptoBroker broker;
+
+void handle_signal(int) {
+    broker.stop();
+}
+
+int main(int argc, char** argv) {
+    if (!broker.open())
+        return 1;
+
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+
+    std::cout << "Serving " << BROKER_SLOTS << " clients at " << BROKER_SHM_NAME << std::endl;
+
+    broker.run();
+
+    // Print MMIO and poll counters for all requests served
+    RSADriver::counters.print(std::cout);
+    RSADriver::software_counters.print(std::cout);
+    SHA3Driver::counters.print(std::cout);
+
+    return 0;
+}
@@ -1,7 +1,7 @@
 #include <iostream>
 
-#include "deps/axidriver.hpp"
-#include "deps/utils.hpp"
+#include "axidriver.hpp"
+#include "utils.hpp"
 
 #define DEVICE_DNA_ADDRESS 0x43C30000
 
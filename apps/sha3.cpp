@@ -1,37 +1,59 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
-#include <chrono>
 
-#include "deps/sha3driver.hpp"
+#include <string>
+
+#include "sha3driver.hpp"
+#include "broker.hpp"
 
 int main(int argc, char** argv) {
     if (argc < 2) {
-        std::cout << "Usage: sha3 <path_to_file*>" << std::endl;
+        std::cout << "Usage: sha3 [--broker] <path_to_file*>" << std::endl;
     }
 
-    for (int i = 1; i < argc; i++) {
+    // Hash through the crypto broker instead of mapping the core directly
+    const bool use_broker = argc > 1 && std::string(argv[1]) == "--broker";
+
+    BrokerConnection connection;
+
+    if (use_broker && !connection.connect())
+        return 1;
+
+    for (int i = use_broker ? 2 : 1; i < argc; i++) {
         // Load file from disk
         std::ifstream in_file (argv[i], std::ios::binary | std::ios::out);
-    
-        // Read file into a single string
-        std::ostringstream oss;
-        oss << in_file.rdbuf();
-        std::string contents = oss.str();
-        in_file.close();
-    
+
         // Run file through SHA-3 core
-        SHA3Driver driver;
+        std::string hash;
 
-        // Time the hashing process
-        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
-        const std::string hash = driver.compute_hash(contents, true);
-        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+        if (use_broker) {
+            // Read the file straight into the slot, so it isn't copied again
+            BrokerSHA3Driver driver (connection);
+            driver.begin();
 
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
-        
-        std::cout << "Result for " << argv[i] << ": " << hash << " Duration: " << duration << std::endl;
+            while (in_file.read(connection.data(), BROKER_SLOT_DATA) || in_file.gcount() > 0)
+                driver.update(connection.data(), in_file.gcount());
+
+            hash = driver.finalize(true);
+        } else {
+            // Read file into a single string
+            std::ostringstream oss;
+            oss << in_file.rdbuf();
+            std::string contents = oss.str();
+
+            SHA3Driver driver;
+            hash = driver.compute_hash(contents, true);
+        }
+
+        in_file.close();
+
+        std::cout << "Result for " << argv[i] << ": " << hash << std::endl;
     }
 
+    // Print MMIO and poll counters for all runs (on the broker's side with --broker)
+    if (!use_broker)
+        SHA3Driver::counters.print(std::cout);
+
     return 0;
 }
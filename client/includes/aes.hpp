@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// AES-128 parameters (in bytes)
+#define AES_BLOCK_SIZE 16
+#define AES_KEY_SIZE   16
+#define AES_ROUNDS     10
+
+// Size of the CTR nonce that prefixes the 64-bit big endian block counter
+#define AES_NONCE_SIZE 8
+
+// Session key as sent (RSA encrypted) in UpdateImage: key || nonce
+#define AES_SESSION_KEY_SIZE (AES_KEY_SIZE + AES_NONCE_SIZE)
+
+// AES-128 in counter mode, used to decrypt the update image body in hybrid mode.
+// Table-driven software implementation (there is no AES core in the PL).
+class AESCTR {
+public:
+    AESCTR(const uint8_t* key, const uint8_t* nonce);
+
+    // Encrypts or decrypts data in place. Successive calls continue the key stream.
+    void apply(uint8_t* data, size_t length);
+
+    // Encrypts a single 16 byte block with the expanded key
+    void encrypt_block(const uint8_t* in, uint8_t* out) const;
+private:
+    // Expanded round keys
+    uint32_t round_keys[4 * (AES_ROUNDS + 1)];
+
+    // Current counter block and its key stream
+    uint8_t counter[AES_BLOCK_SIZE];
+    uint8_t keystream[AES_BLOCK_SIZE];
+
+    // Bytes of keystream already used
+    size_t used = AES_BLOCK_SIZE;
+
+    void expand_key(const uint8_t* key);
+    void next_keystream();
+};
@@ -1,61 +1,124 @@
-#pragma once
-
-#include <cstdint>
-#include <cstring>
-
-#ifdef __linux__
-    #include <sys/mman.h>
-#endif
-
-// Zynq Linux kernel page size
-#define PAGE_SIZE 4096
-
-// Base addresses as configured in HDF
-#define FPGA_BASE_ADDR   0x40000000
-
-// AXI parameters
-#define AXI_WIDTH 4 // bytes
-
-// 64K allocated to each AXI device
-#define DEVICE_MEM_SPACE PAGE_SIZE * 16
-
-class AXIDriver {
-public:
-    AXIDriver(uint32_t base_address) {
-        #ifdef __linux__
-            // TODO: error handling
-            mem = this->get_mmap(base_address, PAGE_SIZE);
-        #else
-            mem = (uint8_t *)base_address;
-        #endif
-    }
-
-    ~AXIDriver() {
-        #ifdef __linux__
-            munmap(mem, PAGE_SIZE);
-        #endif
-    }
-
-    // Read a single 32-bit value from AXI device memory
-    uint32_t read(uint32_t offset);
-
-    // Write a single 32-bit value to AXI device memory
-    void write(uint32_t offset, uint32_t value);
-
-private:
-    // Points to start of AXI components mem space
-    uint8_t *mem;
-
-    #ifdef __linux__
-        // Returns mmap() of some length at given base_addr as a *ptr
-        uint8_t* get_mmap(uint32_t base_addr, size_t length);
-    #endif
-
-    inline uint8_t* compute_offset(uint32_t offset) {
-        /**
-            Computes the offset (in bytes) relative to device base address.
-            Returns uint8_t pointer starting at that address.
-        */
-        return mem + offset;
-    }
-};
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+// Simulated builds talk to software models of the cores instead of /dev/mem
+#ifdef AXI_SIMULATION
+    #include "simulation.hpp"
+#elif defined(__linux__)
+    #define AXI_USE_MMAP
+    #include <sys/mman.h>
+#endif
+
+// Zynq Linux kernel page size
+#define PAGE_SIZE 4096
+
+// Base addresses as configured in HDF
+#define FPGA_BASE_ADDR   0x40000000
+
+// AXI parameters
+#define AXI_WIDTH 4 // bytes
+
+// 64K allocated to each AXI device
+#define DEVICE_MEM_SPACE PAGE_SIZE * 16
+
+// Usage counter that may be incremented from several threads at once. Relaxed
+// atomic increments: totals are exact, but not ordered with other memory.
+struct Counter {
+    std::atomic<uint64_t> value {0};
+
+    void operator++(int) { value.fetch_add(1, std::memory_order_relaxed); }
+    void operator+=(uint64_t n) { value.fetch_add(n, std::memory_order_relaxed); }
+    void operator=(uint64_t n) { value.store(n, std::memory_order_relaxed); }
+    operator uint64_t() const { return value.load(std::memory_order_relaxed); }
+};
+
+// Usage counters shared by all instances of a driver type. Updating them costs
+// a few increments per MMIO access, so they are always enabled.
+struct DriverStats {
+    const char* name;
+
+    Counter reads;       // 32-bit MMIO reads (including polls)
+    Counter writes;      // 32-bit MMIO writes
+    Counter completions; // Number of waits for the core to finish
+    Counter poll_spins;  // Status register reads spent waiting
+    Counter wait_time;   // Time spent waiting (microseconds)
+    Counter chunks;      // Chunks (RSA) or blocks (SHA-3) processed
+    Counter bytes_in;    // Payload bytes written to the core
+    Counter bytes_out;   // Payload bytes read from the core
+
+    DriverStats(const char* name) : name(name) {}
+
+    void reset();
+    void print(std::ostream& out) const;
+};
+
+// Thread safety: a driver instance keeps per-instance state (mapping, partial
+// words) and must only be used by one thread at a time. Separate instances may
+// be used from different threads concurrently; the only state they share is
+// their DriverStats. Arbitrating a single core between instances is up to the
+// driver type (see RSADriver and SHA3Driver).
+class AXIDriver {
+public:
+    // Counters for drivers used directly through AXIDriver
+    static DriverStats generic_stats;
+
+    AXIDriver(uint32_t base_address) : AXIDriver(base_address, generic_stats) {}
+
+    AXIDriver(uint32_t base_address, DriverStats& stats) : stats(stats) {
+        #if defined(AXI_SIMULATION)
+            device = sim_device(base_address);
+        #elif defined(AXI_USE_MMAP)
+            // TODO: error handling
+            mem = this->get_mmap(base_address, PAGE_SIZE);
+        #else
+            mem = (uint8_t *)base_address;
+        #endif
+    }
+
+    ~AXIDriver() {
+        #ifdef AXI_USE_MMAP
+            munmap(mem, PAGE_SIZE);
+        #endif
+    }
+
+    // Read a single 32-bit value from AXI device memory
+    uint32_t read(uint32_t offset);
+
+    // Write a single 32-bit value to AXI device memory
+    void write(uint32_t offset, uint32_t value);
+
+    // Counters of this driver type
+    DriverStats& get_stats() { return stats; }
+
+protected:
+    DriverStats& stats;
+
+    // Polls the register at offset until it reads value, counting spins and wait time
+    void wait_for(uint32_t offset, uint32_t value);
+
+private:
+    // Points to start of AXI components mem space
+    uint8_t *mem;
+
+    #ifdef AXI_SIMULATION
+        // Software model of the core at the base address
+        SimDevice* device;
+    #endif
+
+    #ifdef AXI_USE_MMAP
+        // Returns mmap() of some length at given base_addr as a *ptr
+        uint8_t* get_mmap(uint32_t base_addr, size_t length);
+    #endif
+
+    inline uint8_t* compute_offset(uint32_t offset) {
+        /**
+            Computes the offset (in bytes) relative to device base address.
+            Returns uint8_t pointer starting at that address.
+        */
+        return mem + offset;
+    }
+};
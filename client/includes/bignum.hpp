@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// RSA-512 operands as 32-bit limbs
+#define BIGNUM_LIMBS 16
+#define BIGNUM_BYTES (BIGNUM_LIMBS * 4)
+
+// Public exponent of all RSA keys (F4 = 2^16 + 1)
+#define RSA_PUBLIC_EXPONENT 65537
+
+// Fixed size 512-bit unsigned integer, least significant limb first
+struct BigNum {
+    uint32_t limbs[BIGNUM_LIMBS];
+
+    // Parses a big endian byte string of at most BIGNUM_BYTES bytes
+    static BigNum from_bytes(const uint8_t* bytes, size_t length);
+
+    // Parses a hex string (without 0x prefix) of at most 128 digits
+    static BigNum from_hex(const char* hex);
+
+    // Writes the number as BIGNUM_BYTES big endian bytes
+    void to_bytes(uint8_t* out) const;
+
+    bool operator==(const BigNum& other) const;
+};
+
+// Modular arithmetic for a fixed odd modulus using Montgomery multiplication.
+// Software counterpart of the RSA-512 core in the PL.
+class Montgomery {
+public:
+    Montgomery(const BigNum& modulus);
+
+    // Returns base^exponent mod n
+    BigNum modexp(const BigNum& base, const BigNum& exponent) const;
+
+    // Returns base^RSA_PUBLIC_EXPONENT mod n (16 squarings and one multiplication)
+    BigNum modexp_public(const BigNum& base) const;
+private:
+    BigNum n;
+    BigNum r2;      // R^2 mod n, R = 2^512
+    uint32_t n0inv; // -n^-1 mod 2^32
+
+    // out = a * b * R^-1 mod n
+    void multiply(const BigNum& a, const BigNum& b, BigNum& out) const;
+};
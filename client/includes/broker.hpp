@@ -0,0 +1,197 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#include "rsadriver.hpp"
+#include "sha3driver.hpp"
+
+// Crypto broker: a daemon (apps/cryptobroker) owns the PL cores and serves
+// requests from other processes through a POSIX shared memory region, so that
+// programs mapping the cores through /dev/mem don't corrupt each other's
+// operations. Each client claims a slot with its own payload buffer; requests
+// and results are written in place, without copies through the kernel.
+
+#define BROKER_SHM_NAME "/zynq-crypto-broker"
+#define BROKER_MAGIC    0x5a435242 // "ZCRB"
+#define BROKER_VERSION  3
+
+// Concurrent clients
+#define BROKER_SLOTS 16
+
+// Payload buffer per slot (a multiple of the RSA chunk size). Larger requests
+// are split by the client, so the broker switches between clients at least
+// every BROKER_SLOT_DATA / RSA_CHUNK_SIZE chunks.
+#define BROKER_SLOT_DATA (256 * RSA_CHUNK_SIZE)
+
+// Time between liveness checks of the other side (milliseconds)
+#define BROKER_POLL_INTERVAL 1000
+
+enum BrokerOp {
+    HASH_BEGIN = 0,
+    HASH_UPDATE = 1,
+    HASH_FINALIZE = 2, // arg: readable
+    RSA_ENCRYPT = 3,      // arg: key slot
+    RSA_DECRYPT = 4,      // arg: is_final
+    RSA_ENCRYPT_PART = 5  // arg: key slot; whole chunks of a longer message, no length padding
+};
+
+enum SlotState {
+    SLOT_FREE = 0,    // Not claimed by a client
+    SLOT_IDLE = 1,    // Claimed, no request
+    SLOT_PENDING = 2, // Request waiting for the broker
+    SLOT_BUSY = 3,    // Broker is processing the request
+    SLOT_DONE = 4     // Result ready for the client
+};
+
+// Per-client request slot in shared memory
+struct BrokerSlot {
+    uint32_t state;
+    uint32_t claim;  // Incremented on every claim, to tell clients of a slot apart
+    pid_t owner;
+
+    uint32_t op;
+    uint32_t arg;
+    uint32_t priority; // RSAPriority: interactive requests are served first
+    uint32_t length;   // Request length, then result length
+    uint32_t status;   // 1 if the request succeeded
+
+    // Signalled by the broker when a result is ready
+    pthread_cond_t done;
+
+    uint8_t data[BROKER_SLOT_DATA];
+};
+
+// Layout of the shared memory region
+struct BrokerRegion {
+    uint32_t magic;
+    uint32_t version;
+    pid_t broker;
+
+    // Protects all slot fields except data (owned by whoever processes the request)
+    pthread_mutex_t lock;
+
+    // Signalled by clients when a request is pending
+    pthread_cond_t work;
+
+    BrokerSlot slots[BROKER_SLOTS];
+};
+
+// Daemon side: creates the region and processes requests on the real cores
+class CryptoBroker {
+public:
+    CryptoBroker(const char* name = BROKER_SHM_NAME) : name(name) {}
+    ~CryptoBroker();
+
+    // Creates the shared memory region, replacing a stale one
+    bool open();
+
+    // Serves requests until stop() is called
+    void run();
+    void stop();
+private:
+    const char* name;
+    BrokerRegion* region = NULL;
+    volatile bool running = true;
+
+    RSADriver rsa;
+    SHA3Driver sha3;
+
+    // Result of the request being processed (keeps its capacity)
+    std::string result;
+
+    // Slot (and its claim) whose hash is in progress on the SHA-3 core, or -1
+    int hash_owner = -1;
+    uint32_t hash_claim = 0;
+
+    // Slot served last, the search for the next request starts after it
+    int last_served = BROKER_SLOTS - 1;
+
+    // Returns the next pending slot to serve, or -1 (lock held)
+    int next_request();
+
+    // Same, only considering interactive requests if interactive_only is set
+    int next_request(bool interactive_only);
+
+    // Frees slots of clients that exited without releasing them (lock held)
+    void reap_clients();
+
+    // Runs the request in a slot on the cores, outside the lock
+    void process(BrokerSlot& slot);
+};
+
+// Client side: a claimed slot in the broker's region
+class BrokerConnection {
+public:
+    BrokerConnection(const char* name = BROKER_SHM_NAME) : name(name) {}
+    ~BrokerConnection();
+
+    // Maps the region and claims a free slot
+    bool connect();
+    void disconnect();
+    bool connected() const { return slot != NULL; }
+
+    // The calling thread's connection to the default broker, connected on
+    // first use (and again after the broker restarted). Used by the drivers'
+    // default constructors, so each thread of a process has its own slot.
+    static BrokerConnection& thread_connection();
+
+    // Payload buffer of the slot (BROKER_SLOT_DATA bytes), or NULL when not
+    // connected. Requests can be written to it directly, and the result of a
+    // request stays in it until the next one
+    char* data() { return slot ? reinterpret_cast<char *>(slot->data) : NULL; }
+
+    // Sends a request and waits for its result, which is left in data() with
+    // its length in result_length. input is copied into data() first, unless
+    // it already is data(). Input and result must fit in BROKER_SLOT_DATA
+    // bytes. Returns false if the request failed or the broker is gone.
+    bool call(BrokerOp op, uint32_t arg, const char* input, size_t length, size_t& result_length,
+              RSAPriority priority = RSAPriority::INTERACTIVE);
+private:
+    const char* name;
+    BrokerRegion* region = NULL;
+    BrokerSlot* slot = NULL;
+};
+
+// Counterparts of RSADriver and SHA3Driver that run on the broker's cores,
+// through the given connection or the thread's. Like the drivers, an instance
+// must only be used by one thread at a time. Encryption always runs on the
+// broker's core (set_public_key() contexts aren't used).
+class BrokerRSADriver {
+public:
+    BrokerRSADriver() : connection(BrokerConnection::thread_connection()) {}
+    BrokerRSADriver(BrokerConnection& connection) : connection(connection) {}
+
+    // Return an empty string if a request failed
+    std::string decrypt(const std::string& ciphertext, bool is_final = true);
+    std::string encrypt(const std::string& plaintext, RSAKey key);
+
+    // Same, writing the result into a caller's string (cleared if a request failed)
+    void decrypt(const std::string& ciphertext, std::string& plaintext, bool is_final = true);
+    void decrypt(const char* ciphertext, size_t size, std::string& plaintext, bool is_final = true);
+    void encrypt(const std::string& plaintext, RSAKey key, std::string& ciphertext);
+
+    // Priority of this driver's requests at the broker (BULK for image decryption)
+    RSAPriority priority = RSAPriority::INTERACTIVE;
+private:
+    BrokerConnection& connection;
+};
+
+// Data passed to update() straight from the connection's data() isn't copied
+class BrokerSHA3Driver {
+public:
+    BrokerSHA3Driver() : connection(BrokerConnection::thread_connection()) {}
+    BrokerSHA3Driver(BrokerConnection& connection) : connection(connection) {}
+
+    std::string compute_hash(std::string& data, bool readable);
+
+    void begin();
+    void update(const char* data, size_t length);
+    std::string finalize(bool readable);
+private:
+    BrokerConnection& connection;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "session.hpp" // for ConfirmingOrg
+
+// Runtime settings of the updater. The config file has one setting per line
+// (lines starting with # are comments):
+//
+//     id <device ID>
+//     version <installed version>    until an update is installed (then current_image.version)
+//     quorum <k>                     matching confirming hashes needed (default: all orgs)
+//     org <ip> <port> <key slot>     one line per confirming org G_C,i (slots GC_PUB and up)
+//     encrypt <0|1>                  encrypted protocol and image (default 1, must match the server)
+//     debug <0|1>                    print diagnostics and driver counters (default 1)
+//     broker <0|1>                   use the cores through the crypto broker daemon (default 0)
+//     notify <port>                  server's release notification port (default: G_U port - 1)
+//     pubkey <key slot> <modulus>    RSA-512 modulus (128 hex digits) of the public key in a
+//                                    slot, to encrypt to it in software instead of the core
+
+// Public key loaded into a PL key slot (the exponent is RSA_PUBLIC_EXPONENT)
+struct PublicKey {
+    RSAKey key;
+    std::string modulus;
+};
+
+struct UpdaterConfig {
+    uint32_t id = 0;
+    uint32_t version = 0;
+    uint32_t quorum = 0;
+    std::vector<ConfirmingOrg> orgs;
+    bool encrypt = true;
+    bool debug = true;
+    bool broker = false;
+    uint32_t notify_port = 0;
+    std::vector<PublicKey> public_keys;
+};
+
+// Reads the settings in the config file at path into config; settings the
+// file leaves out (or a missing file) keep their current value. Returns false
+// if a line is invalid.
+bool load_config(const char* path, UpdaterConfig& config);
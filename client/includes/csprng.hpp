@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// ChaCha20 parameters (in bytes)
+#define CHACHA_KEY_SIZE   32
+#define CHACHA_NONCE_SIZE 12
+#define CHACHA_BLOCK_SIZE 64
+
+// Key stream blocks generated per refill of a generator's buffer
+#define CSPRNG_BUFFER_BLOCKS 8
+
+// ChaCha20 block function (RFC 8439, section 2.3)
+void chacha20_block(const uint8_t* key, uint32_t counter, const uint8_t* nonce, uint8_t* out);
+
+// Cryptographically secure generator: ChaCha20 key stream, seeded from the OS
+// (getrandom) and served from a buffer. The first 32 bytes of every refill
+// replace the key, so earlier output can't be recovered from the state.
+class CSPRNG {
+public:
+    CSPRNG();
+    ~CSPRNG();
+
+    // Fills out with length random bytes
+    void fill(void* out, size_t length);
+private:
+    uint8_t key[CHACHA_KEY_SIZE];
+    uint8_t buffer[CSPRNG_BUFFER_BLOCKS * CHACHA_BLOCK_SIZE];
+
+    // Bytes of the buffer already used
+    size_t used = sizeof(buffer);
+
+    void refill();
+};
+
+// Fills out with length random bytes from the calling thread's generator
+void random_bytes(void* out, size_t length);
+
+// Returns 32 random bits from the calling thread's generator
+uint32_t random_word();
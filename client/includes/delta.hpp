@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+#include "image.hpp"
+
+// Patch operations in the body of a delta image (see server/update_image.py)
+#define DELTA_OP_COPY 0x01 // offset (4 bytes), length (4 bytes): copy from base image body
+#define DELTA_OP_DATA 0x02 // length (4 bytes), data: literal bytes
+
+// Size of the buffer used to stream data into the patched image
+#define DELTA_BUFFER_SIZE 65536
+
+// Applies the delta image at delta_path to the installed image at base_path,
+// and writes the resulting full image to output_path, hashing it with SHA3
+// (SHA3Driver or BrokerSHA3Driver).
+// Returns true only if the hash of the patched body matches the delta header hash.
+template <typename SHA3>
+bool apply_delta(const char* base_path, const char* delta_path, const char* output_path);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+
+#include "sha3driver.hpp" // for HASH_SIZE
+
+// Update image header flags, stored in the upper bits of the field count byte
+// See server/update_image.py for the image format
+#define IMAGE_FIELD_MASK  0x3F
+#define IMAGE_FLAG_DELTA  0x80 // Body is a patch against the installed image
+#define IMAGE_FLAG_COMPRESSED 0x40 // Body is an LZ4 frame
+
+struct ImageHeader {
+    // Image flags (IMAGE_FLAG_*)
+    uint8_t flags = 0;
+
+    // Field sizes
+    std::vector<uint32_t> sizes;
+
+    // SHA3 hash of the (full) image body
+    std::string hash;
+
+    // SHA3 hash of the base image body (delta images only)
+    std::string base_hash;
+
+    // Size of the header in bytes
+    uint32_t size() const;
+
+    // Size of the (full) image body in bytes, i.e., sum of all field sizes
+    uint64_t body_size() const;
+};
+
+// Reads the header at the start of the given image. Returns false if the image can't be read.
+bool read_image_header(const char* path, ImageHeader& header);
+
+// Reads a header from the current position of an image stream
+bool read_image_header(std::istream& image, ImageHeader& header);
+
+// Writes the given header to the current position of an output image
+void write_image_header(std::ostream& image, const ImageHeader& header);
+
+// Writes each field of a full image to its own file, named <prefix><index>.bin
+bool extract_image(const char* path, const char* prefix);
+
+// Checks an image against the hash confirmed by the orgs while it is being
+// decrypted, so a bad image is rejected before it is fully processed:
+// the header hash is compared as soon as the header is complete, and the body
+// of a full (uncompressed, non-delta) image is hashed on the fly, with SHA3
+// (SHA3Driver or BrokerSHA3Driver).
+template <typename SHA3>
+class ImageCheck {
+public:
+    // An empty confirmed hash disables the check
+    ImageCheck(const std::string& confirmed_hash) : confirmed_hash(confirmed_hash) {}
+
+    // Feeds the next decrypted bytes. Returns false as soon as the image can't match
+    bool update(const char* data, size_t length);
+
+    // Returns false if the body hash of a full image doesn't match. Sets
+    // body_hash to that hash, or clears it if the body wasn't hashed
+    bool finalize(std::string& body_hash);
+private:
+    const std::string confirmed_hash;
+
+    // Start of the image until the header is complete
+    std::string header_data;
+    ImageHeader header;
+    bool header_done = false;
+
+    // Hash the body while streaming (full images only)
+    bool hash_body = false;
+    SHA3 sha3;
+
+    // Header hash doesn't match
+    bool rejected = false;
+};
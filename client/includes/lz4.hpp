@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+
+// LZ4 frame format parameters (see https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md)
+#define LZ4_MAGIC           0x184D2204
+#define LZ4_FLG_VERSION     0x40
+#define LZ4_FLG_BLOCK_CSUM  0x10
+#define LZ4_FLG_SIZE        0x08
+#define LZ4_FLG_CONTENT_CSUM 0x04
+#define LZ4_FLG_DICT_ID     0x01
+#define LZ4_UNCOMPRESSED    0x80000000
+
+// Only frames with blocks of at most 64 KB are accepted, which bounds memory use
+// to the 64 KB match window plus one block of input and one block of output
+#define LZ4_BLOCK_SIZE  65536
+#define LZ4_WINDOW_SIZE 65536
+
+// Decompresses a single LZ4 frame from input and writes the result to output.
+// Returns the number of bytes written, or -1 if the frame is invalid.
+int64_t lz4_decompress_frame(std::ifstream& input, std::ofstream& output);
+
+// Decompresses the body of a compressed update image at input_path and writes
+// the uncompressed image (with IMAGE_FLAG_COMPRESSED cleared) to output_path.
+bool decompress_image(const char* input_path, const char* output_path);
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "session.hpp" // for asio
+
+// Backoff between attempts to reach the notification channel (seconds). The
+// delay doubles after every failure up to the maximum, and each wait is drawn
+// uniformly from [0, delay] so that devices cut off together don't reconnect
+// together.
+#define NOTIFY_BACKOFF_MIN 1
+#define NOTIFY_BACKOFF_MAX 300
+
+// The server sends a heartbeat every 60 seconds; a connection that stays silent
+// for this long is considered dead (seconds)
+#define NOTIFY_TIMEOUT 180
+
+// Receive buffer for notifications (each is 1 to 3 bytes)
+#define NOTIFY_BUFFER_SIZE 64
+
+// Device end of the server's notification channel (server/notify.py): a
+// long-lived connection on which the server announces new releases, so the
+// updater daemon can check right away instead of polling often.
+class UpdateNotifier {
+public:
+    UpdateNotifier(asio::io_service& io_service, const asio::ip::tcp::endpoint& endpoint)
+        : socket(io_service), endpoint(endpoint) {}
+
+    // Blocks until a release is announced (returns true) or the timeout
+    // passes (returns false). Connects and reconnects as needed.
+    bool wait(std::chrono::steady_clock::duration timeout);
+private:
+    asio::ip::tcp::socket socket;
+    const asio::ip::tcp::endpoint endpoint;
+
+    // Current reconnect delay (seconds)
+    uint32_t backoff = NOTIFY_BACKOFF_MIN;
+
+    // Earliest time of the next connection attempt
+    std::chrono::steady_clock::time_point next_attempt;
+
+    // Bytes received but not yet parsed
+    char buf[NOTIFY_BUFFER_SIZE];
+    size_t buffered = 0;
+
+    // Time of the last message from the server
+    std::chrono::steady_clock::time_point last_message;
+
+    bool connect();
+    void disconnect();
+
+    // Parses the buffered notifications; returns true if one announces a release
+    bool parse();
+};
+
+// Uniformly distributed delay in [0, max_seconds], in milliseconds
+std::chrono::milliseconds jitter(uint32_t max_seconds);
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+#include "rsadriver.hpp"
+#include "sha3driver.hpp"
+#include "broker.hpp"
+
+// Encryption, debug and core policies. Code paths that depend on them are
+// templates on the policy, so all variants are compiled in and the updater picks
+// one at startup (encrypt, debug and broker in updater.conf). Within an
+// instantiation the choice is a constant: the decrypt and hash loops have no
+// branches on it.
+
+// The updater maps the cores itself
+struct DirectCores {
+    static constexpr bool broker = false;
+
+    typedef RSADriver RSA;
+    typedef SHA3Driver SHA3;
+};
+
+// The crypto broker daemon owns the cores (broker.hpp), so other programs on
+// the device can use them while the updater runs
+struct BrokerCores {
+    static constexpr bool broker = true;
+
+    typedef BrokerRSADriver RSA;
+    typedef BrokerSHA3Driver SHA3;
+};
+
+// Protocol messages and images are RSA encrypted (the server's ENCRYPT = True),
+// on the RSA core of the given cores policy
+template <typename Cores>
+class EncryptedOn {
+public:
+    static constexpr bool enabled = true;
+
+    explicit EncryptedOn(RSAPriority priority = RSAPriority::INTERACTIVE) {
+        rsa.priority = priority;
+    }
+
+    // Decrypts data with the device key into buffer
+    void decrypt(const char* data, size_t size, std::string& buffer, bool is_final = true) {
+        rsa.decrypt(data, size, buffer, is_final);
+    }
+
+    // Same, returning the plaintext (buffer)
+    const std::string& decrypt(const std::string& data, std::string& buffer, bool is_final = true) {
+        rsa.decrypt(data, buffer, is_final);
+        return buffer;
+    }
+
+    // Encrypts data to the public key in the given slot, returning the ciphertext (buffer)
+    const std::string& encrypt(const std::string& data, RSAKey key, std::string& buffer) {
+        rsa.encrypt(data, key, buffer);
+        return buffer;
+    }
+private:
+    typename Cores::RSA rsa;
+};
+
+typedef EncryptedOn<DirectCores> Encrypted;
+typedef EncryptedOn<BrokerCores> BrokerEncrypted;
+
+// Protocol messages and images are sent in plaintext (the server's ENCRYPT =
+// False), e.g., to measure the cost of encryption. Doesn't use the RSA core.
+class Plaintext {
+public:
+    static constexpr bool enabled = false;
+
+    explicit Plaintext(RSAPriority priority = RSAPriority::INTERACTIVE) {}
+
+    void decrypt(const char* data, size_t size, std::string& buffer, bool is_final = true) {
+        buffer.assign(data, size);
+    }
+
+    // Returns data itself, without a copy
+    const std::string& decrypt(const std::string& data, std::string& buffer, bool is_final = true) {
+        return data;
+    }
+
+    const std::string& encrypt(const std::string& data, RSAKey key, std::string& buffer) {
+        return data;
+    }
+};
+
+// Prints diagnostics: hash mismatch details and driver counters
+struct Verbose {
+    static constexpr bool enabled = true;
+};
+
+struct Quiet {
+    static constexpr bool enabled = false;
+};
@@ -1,1038 +1,1565 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: protocol.proto
 
-#ifndef PROTOBUF_protocol_2eproto__INCLUDED
-#define PROTOBUF_protocol_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_protocol_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_protocol_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3004000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_protocol_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_protocol_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_protocol_2eproto;
 class DeviceChallenge;
-class DeviceChallengeDefaultTypeInternal;
+struct DeviceChallengeDefaultTypeInternal;
 extern DeviceChallengeDefaultTypeInternal _DeviceChallenge_default_instance_;
 class M1;
-class M1DefaultTypeInternal;
+struct M1DefaultTypeInternal;
 extern M1DefaultTypeInternal _M1_default_instance_;
 class M2;
-class M2DefaultTypeInternal;
+struct M2DefaultTypeInternal;
 extern M2DefaultTypeInternal _M2_default_instance_;
 class M3;
-class M3DefaultTypeInternal;
+struct M3DefaultTypeInternal;
 extern M3DefaultTypeInternal _M3_default_instance_;
 class OrgChallenge;
-class OrgChallengeDefaultTypeInternal;
+struct OrgChallengeDefaultTypeInternal;
 extern OrgChallengeDefaultTypeInternal _OrgChallenge_default_instance_;
 class OrgResponse;
-class OrgResponseDefaultTypeInternal;
+struct OrgResponseDefaultTypeInternal;
 extern OrgResponseDefaultTypeInternal _OrgResponse_default_instance_;
 class UpdateCheck;
-class UpdateCheckDefaultTypeInternal;
+struct UpdateCheckDefaultTypeInternal;
 extern UpdateCheckDefaultTypeInternal _UpdateCheck_default_instance_;
 class UpdateImage;
-class UpdateImageDefaultTypeInternal;
+struct UpdateImageDefaultTypeInternal;
 extern UpdateImageDefaultTypeInternal _UpdateImage_default_instance_;
 class UpdateStatus;
-class UpdateStatusDefaultTypeInternal;
+struct UpdateStatusDefaultTypeInternal;
 extern UpdateStatusDefaultTypeInternal _UpdateStatus_default_instance_;
-
-namespace protobuf_protocol_2eproto {
-// Internal implementation detail -- do not call these.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[];
-  static const ::google::protobuf::uint32 offsets[];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static void InitDefaultsImpl();
-};
-void AddDescriptors();
-void InitDefaults();
-}  // namespace protobuf_protocol_2eproto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::DeviceChallenge* Arena::CreateMaybeMessage<::DeviceChallenge>(Arena*);
+template<> ::M1* Arena::CreateMaybeMessage<::M1>(Arena*);
+template<> ::M2* Arena::CreateMaybeMessage<::M2>(Arena*);
+template<> ::M3* Arena::CreateMaybeMessage<::M3>(Arena*);
+template<> ::OrgChallenge* Arena::CreateMaybeMessage<::OrgChallenge>(Arena*);
+template<> ::OrgResponse* Arena::CreateMaybeMessage<::OrgResponse>(Arena*);
+template<> ::UpdateCheck* Arena::CreateMaybeMessage<::UpdateCheck>(Arena*);
+template<> ::UpdateImage* Arena::CreateMaybeMessage<::UpdateImage>(Arena*);
+template<> ::UpdateStatus* Arena::CreateMaybeMessage<::UpdateStatus>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class UpdateCheck : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:UpdateCheck) */ {
+class UpdateCheck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UpdateCheck) */ {
  public:
-  UpdateCheck();
-  virtual ~UpdateCheck();
+  inline UpdateCheck() : UpdateCheck(nullptr) {}
+  ~UpdateCheck() override;
+  explicit PROTOBUF_CONSTEXPR UpdateCheck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdateCheck(const UpdateCheck& from);
-
-  inline UpdateCheck& operator=(const UpdateCheck& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   UpdateCheck(UpdateCheck&& from) noexcept
     : UpdateCheck() {
     *this = ::std::move(from);
   }
 
+  inline UpdateCheck& operator=(const UpdateCheck& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline UpdateCheck& operator=(UpdateCheck&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UpdateCheck& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateCheck& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const UpdateCheck* internal_default_instance() {
     return reinterpret_cast<const UpdateCheck*>(
                &_UpdateCheck_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(UpdateCheck* other);
   friend void swap(UpdateCheck& a, UpdateCheck& b) {
     a.Swap(&b);
   }
+  inline void Swap(UpdateCheck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateCheck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateCheck* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  UpdateCheck* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  UpdateCheck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateCheck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdateCheck& from);
-  void MergeFrom(const UpdateCheck& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateCheck& from) {
+    UpdateCheck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(UpdateCheck* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UpdateCheck";
   }
+  protected:
+  explicit UpdateCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHIFieldNumber = 3,
+    kVFieldNumber = 1,
+    kIDFieldNumber = 2,
+  };
+  // bytes HI = 3;
+  void clear_hi();
+  const std::string& hi() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hi(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hi();
+  PROTOBUF_NODISCARD std::string* release_hi();
+  void set_allocated_hi(std::string* hi);
+  private:
+  const std::string& _internal_hi() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hi(const std::string& value);
+  std::string* _internal_mutable_hi();
+  public:
+
   // uint32 V = 1;
   void clear_v();
-  static const int kVFieldNumber = 1;
-  ::google::protobuf::uint32 v() const;
-  void set_v(::google::protobuf::uint32 value);
+  uint32_t v() const;
+  void set_v(uint32_t value);
+  private:
+  uint32_t _internal_v() const;
+  void _internal_set_v(uint32_t value);
+  public:
 
   // uint32 ID = 2;
   void clear_id();
-  static const int kIDFieldNumber = 2;
-  ::google::protobuf::uint32 id() const;
-  void set_id(::google::protobuf::uint32 value);
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:UpdateCheck)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 v_;
-  ::google::protobuf::uint32 id_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hi_;
+    uint32_t v_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateStatus : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:UpdateStatus) */ {
+class UpdateStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UpdateStatus) */ {
  public:
-  UpdateStatus();
-  virtual ~UpdateStatus();
+  inline UpdateStatus() : UpdateStatus(nullptr) {}
+  ~UpdateStatus() override;
+  explicit PROTOBUF_CONSTEXPR UpdateStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdateStatus(const UpdateStatus& from);
-
-  inline UpdateStatus& operator=(const UpdateStatus& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   UpdateStatus(UpdateStatus&& from) noexcept
     : UpdateStatus() {
     *this = ::std::move(from);
   }
 
+  inline UpdateStatus& operator=(const UpdateStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline UpdateStatus& operator=(UpdateStatus&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UpdateStatus& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateStatus& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const UpdateStatus* internal_default_instance() {
     return reinterpret_cast<const UpdateStatus*>(
                &_UpdateStatus_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(UpdateStatus* other);
   friend void swap(UpdateStatus& a, UpdateStatus& b) {
     a.Swap(&b);
   }
+  inline void Swap(UpdateStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateStatus* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  UpdateStatus* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  UpdateStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdateStatus& from);
-  void MergeFrom(const UpdateStatus& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateStatus& from) {
+    UpdateStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(UpdateStatus* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UpdateStatus";
   }
+  protected:
+  explicit UpdateStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSuccessfulFieldNumber = 1,
+    kParallelAuthFieldNumber = 2,
+  };
   // bool successful = 1;
   void clear_successful();
-  static const int kSuccessfulFieldNumber = 1;
   bool successful() const;
   void set_successful(bool value);
+  private:
+  bool _internal_successful() const;
+  void _internal_set_successful(bool value);
+  public:
+
+  // bool parallel_auth = 2;
+  void clear_parallel_auth();
+  bool parallel_auth() const;
+  void set_parallel_auth(bool value);
+  private:
+  bool _internal_parallel_auth() const;
+  void _internal_set_parallel_auth(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:UpdateStatus)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool successful_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool successful_;
+    bool parallel_auth_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OrgChallenge : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:OrgChallenge) */ {
+class OrgChallenge final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OrgChallenge) */ {
  public:
-  OrgChallenge();
-  virtual ~OrgChallenge();
+  inline OrgChallenge() : OrgChallenge(nullptr) {}
+  ~OrgChallenge() override;
+  explicit PROTOBUF_CONSTEXPR OrgChallenge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   OrgChallenge(const OrgChallenge& from);
-
-  inline OrgChallenge& operator=(const OrgChallenge& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   OrgChallenge(OrgChallenge&& from) noexcept
     : OrgChallenge() {
     *this = ::std::move(from);
   }
 
+  inline OrgChallenge& operator=(const OrgChallenge& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline OrgChallenge& operator=(OrgChallenge&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const OrgChallenge& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OrgChallenge& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const OrgChallenge* internal_default_instance() {
     return reinterpret_cast<const OrgChallenge*>(
                &_OrgChallenge_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(OrgChallenge* other);
   friend void swap(OrgChallenge& a, OrgChallenge& b) {
     a.Swap(&b);
   }
+  inline void Swap(OrgChallenge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OrgChallenge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline OrgChallenge* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  OrgChallenge* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  OrgChallenge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OrgChallenge>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const OrgChallenge& from);
-  void MergeFrom(const OrgChallenge& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OrgChallenge& from) {
+    OrgChallenge::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(OrgChallenge* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OrgChallenge";
   }
+  protected:
+  explicit OrgChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNGFieldNumber = 1,
+    kIGFieldNumber = 2,
+  };
   // uint64 NG = 1;
   void clear_ng();
-  static const int kNGFieldNumber = 1;
-  ::google::protobuf::uint64 ng() const;
-  void set_ng(::google::protobuf::uint64 value);
+  uint64_t ng() const;
+  void set_ng(uint64_t value);
+  private:
+  uint64_t _internal_ng() const;
+  void _internal_set_ng(uint64_t value);
+  public:
 
   // uint32 IG = 2;
   void clear_ig();
-  static const int kIGFieldNumber = 2;
-  ::google::protobuf::uint32 ig() const;
-  void set_ig(::google::protobuf::uint32 value);
+  uint32_t ig() const;
+  void set_ig(uint32_t value);
+  private:
+  uint32_t _internal_ig() const;
+  void _internal_set_ig(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:OrgChallenge)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint64 ng_;
-  ::google::protobuf::uint32 ig_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t ng_;
+    uint32_t ig_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeviceChallenge : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:DeviceChallenge) */ {
+class DeviceChallenge final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:DeviceChallenge) */ {
  public:
-  DeviceChallenge();
-  virtual ~DeviceChallenge();
+  inline DeviceChallenge() : DeviceChallenge(nullptr) {}
+  ~DeviceChallenge() override;
+  explicit PROTOBUF_CONSTEXPR DeviceChallenge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeviceChallenge(const DeviceChallenge& from);
-
-  inline DeviceChallenge& operator=(const DeviceChallenge& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DeviceChallenge(DeviceChallenge&& from) noexcept
     : DeviceChallenge() {
     *this = ::std::move(from);
   }
 
+  inline DeviceChallenge& operator=(const DeviceChallenge& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DeviceChallenge& operator=(DeviceChallenge&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DeviceChallenge& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeviceChallenge& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DeviceChallenge* internal_default_instance() {
     return reinterpret_cast<const DeviceChallenge*>(
                &_DeviceChallenge_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(DeviceChallenge* other);
   friend void swap(DeviceChallenge& a, DeviceChallenge& b) {
     a.Swap(&b);
   }
+  inline void Swap(DeviceChallenge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeviceChallenge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DeviceChallenge* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  DeviceChallenge* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  DeviceChallenge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeviceChallenge>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeviceChallenge& from);
-  void MergeFrom(const DeviceChallenge& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeviceChallenge& from) {
+    DeviceChallenge::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(DeviceChallenge* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "DeviceChallenge";
   }
+  protected:
+  explicit DeviceChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNGFieldNumber = 1,
+    kNDFieldNumber = 2,
+    kIDFieldNumber = 3,
+  };
   // uint64 NG = 1;
   void clear_ng();
-  static const int kNGFieldNumber = 1;
-  ::google::protobuf::uint64 ng() const;
-  void set_ng(::google::protobuf::uint64 value);
+  uint64_t ng() const;
+  void set_ng(uint64_t value);
+  private:
+  uint64_t _internal_ng() const;
+  void _internal_set_ng(uint64_t value);
+  public:
 
   // uint64 ND = 2;
   void clear_nd();
-  static const int kNDFieldNumber = 2;
-  ::google::protobuf::uint64 nd() const;
-  void set_nd(::google::protobuf::uint64 value);
+  uint64_t nd() const;
+  void set_nd(uint64_t value);
+  private:
+  uint64_t _internal_nd() const;
+  void _internal_set_nd(uint64_t value);
+  public:
 
   // uint32 ID = 3;
   void clear_id();
-  static const int kIDFieldNumber = 3;
-  ::google::protobuf::uint32 id() const;
-  void set_id(::google::protobuf::uint32 value);
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:DeviceChallenge)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint64 ng_;
-  ::google::protobuf::uint64 nd_;
-  ::google::protobuf::uint32 id_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t ng_;
+    uint64_t nd_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OrgResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:OrgResponse) */ {
+class OrgResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OrgResponse) */ {
  public:
-  OrgResponse();
-  virtual ~OrgResponse();
+  inline OrgResponse() : OrgResponse(nullptr) {}
+  ~OrgResponse() override;
+  explicit PROTOBUF_CONSTEXPR OrgResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   OrgResponse(const OrgResponse& from);
-
-  inline OrgResponse& operator=(const OrgResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   OrgResponse(OrgResponse&& from) noexcept
     : OrgResponse() {
     *this = ::std::move(from);
   }
 
+  inline OrgResponse& operator=(const OrgResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline OrgResponse& operator=(OrgResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const OrgResponse& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OrgResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const OrgResponse* internal_default_instance() {
     return reinterpret_cast<const OrgResponse*>(
                &_OrgResponse_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(OrgResponse* other);
   friend void swap(OrgResponse& a, OrgResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(OrgResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OrgResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline OrgResponse* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  OrgResponse* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  OrgResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OrgResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const OrgResponse& from);
-  void MergeFrom(const OrgResponse& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OrgResponse& from) {
+    OrgResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(OrgResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OrgResponse";
   }
+  protected:
+  explicit OrgResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHCFieldNumber = 3,
+    kNDFieldNumber = 1,
+    kIGFieldNumber = 2,
+  };
   // bytes HC = 3;
   void clear_hc();
-  static const int kHCFieldNumber = 3;
-  const ::std::string& hc() const;
-  void set_hc(const ::std::string& value);
-  #if LANG_CXX11
-  void set_hc(::std::string&& value);
-  #endif
-  void set_hc(const char* value);
-  void set_hc(const void* value, size_t size);
-  ::std::string* mutable_hc();
-  ::std::string* release_hc();
-  void set_allocated_hc(::std::string* hc);
+  const std::string& hc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hc();
+  PROTOBUF_NODISCARD std::string* release_hc();
+  void set_allocated_hc(std::string* hc);
+  private:
+  const std::string& _internal_hc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hc(const std::string& value);
+  std::string* _internal_mutable_hc();
+  public:
 
   // uint64 ND = 1;
   void clear_nd();
-  static const int kNDFieldNumber = 1;
-  ::google::protobuf::uint64 nd() const;
-  void set_nd(::google::protobuf::uint64 value);
+  uint64_t nd() const;
+  void set_nd(uint64_t value);
+  private:
+  uint64_t _internal_nd() const;
+  void _internal_set_nd(uint64_t value);
+  public:
 
   // uint32 IG = 2;
   void clear_ig();
-  static const int kIGFieldNumber = 2;
-  ::google::protobuf::uint32 ig() const;
-  void set_ig(::google::protobuf::uint32 value);
+  uint32_t ig() const;
+  void set_ig(uint32_t value);
+  private:
+  uint32_t _internal_ig() const;
+  void _internal_set_ig(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:OrgResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr hc_;
-  ::google::protobuf::uint64 nd_;
-  ::google::protobuf::uint32 ig_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hc_;
+    uint64_t nd_;
+    uint32_t ig_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class M1 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:M1) */ {
+class M1 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:M1) */ {
  public:
-  M1();
-  virtual ~M1();
+  inline M1() : M1(nullptr) {}
+  ~M1() override;
+  explicit PROTOBUF_CONSTEXPR M1(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   M1(const M1& from);
-
-  inline M1& operator=(const M1& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   M1(M1&& from) noexcept
     : M1() {
     *this = ::std::move(from);
   }
 
+  inline M1& operator=(const M1& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline M1& operator=(M1&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const M1& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const M1& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const M1* internal_default_instance() {
     return reinterpret_cast<const M1*>(
                &_M1_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(M1* other);
   friend void swap(M1& a, M1& b) {
     a.Swap(&b);
   }
+  inline void Swap(M1* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(M1* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline M1* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  M1* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  M1* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<M1>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const M1& from);
-  void MergeFrom(const M1& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const M1& from) {
+    M1::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(M1* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "M1";
   }
+  protected:
+  explicit M1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kOCFieldNumber = 2,
+    kVFieldNumber = 1,
+  };
   // bytes OC = 2;
   void clear_oc();
-  static const int kOCFieldNumber = 2;
-  const ::std::string& oc() const;
-  void set_oc(const ::std::string& value);
-  #if LANG_CXX11
-  void set_oc(::std::string&& value);
-  #endif
-  void set_oc(const char* value);
-  void set_oc(const void* value, size_t size);
-  ::std::string* mutable_oc();
-  ::std::string* release_oc();
-  void set_allocated_oc(::std::string* oc);
+  const std::string& oc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_oc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_oc();
+  PROTOBUF_NODISCARD std::string* release_oc();
+  void set_allocated_oc(std::string* oc);
+  private:
+  const std::string& _internal_oc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oc(const std::string& value);
+  std::string* _internal_mutable_oc();
+  public:
 
   // uint32 V = 1;
   void clear_v();
-  static const int kVFieldNumber = 1;
-  ::google::protobuf::uint32 v() const;
-  void set_v(::google::protobuf::uint32 value);
+  uint32_t v() const;
+  void set_v(uint32_t value);
+  private:
+  uint32_t _internal_v() const;
+  void _internal_set_v(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:M1)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr oc_;
-  ::google::protobuf::uint32 v_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oc_;
+    uint32_t v_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class M2 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:M2) */ {
+class M2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:M2) */ {
  public:
-  M2();
-  virtual ~M2();
+  inline M2() : M2(nullptr) {}
+  ~M2() override;
+  explicit PROTOBUF_CONSTEXPR M2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   M2(const M2& from);
-
-  inline M2& operator=(const M2& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   M2(M2&& from) noexcept
     : M2() {
     *this = ::std::move(from);
   }
 
+  inline M2& operator=(const M2& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline M2& operator=(M2&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const M2& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const M2& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const M2* internal_default_instance() {
     return reinterpret_cast<const M2*>(
                &_M2_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(M2* other);
   friend void swap(M2& a, M2& b) {
     a.Swap(&b);
   }
+  inline void Swap(M2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(M2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline M2* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  M2* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  M2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<M2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const M2& from);
-  void MergeFrom(const M2& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const M2& from) {
+    M2::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(M2* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "M2";
   }
+  protected:
+  explicit M2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDCFieldNumber = 1,
+  };
   // bytes DC = 1;
   void clear_dc();
-  static const int kDCFieldNumber = 1;
-  const ::std::string& dc() const;
-  void set_dc(const ::std::string& value);
-  #if LANG_CXX11
-  void set_dc(::std::string&& value);
-  #endif
-  void set_dc(const char* value);
-  void set_dc(const void* value, size_t size);
-  ::std::string* mutable_dc();
-  ::std::string* release_dc();
-  void set_allocated_dc(::std::string* dc);
+  const std::string& dc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dc();
+  PROTOBUF_NODISCARD std::string* release_dc();
+  void set_allocated_dc(std::string* dc);
+  private:
+  const std::string& _internal_dc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dc(const std::string& value);
+  std::string* _internal_mutable_dc();
+  public:
 
   // @@protoc_insertion_point(class_scope:M2)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr dc_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dc_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class M3 : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:M3) */ {
+class M3 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:M3) */ {
  public:
-  M3();
-  virtual ~M3();
+  inline M3() : M3(nullptr) {}
+  ~M3() override;
+  explicit PROTOBUF_CONSTEXPR M3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   M3(const M3& from);
-
-  inline M3& operator=(const M3& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   M3(M3&& from) noexcept
     : M3() {
     *this = ::std::move(from);
   }
 
+  inline M3& operator=(const M3& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline M3& operator=(M3&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const M3& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const M3& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const M3* internal_default_instance() {
     return reinterpret_cast<const M3*>(
                &_M3_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(M3* other);
   friend void swap(M3& a, M3& b) {
     a.Swap(&b);
   }
+  inline void Swap(M3* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(M3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline M3* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  M3* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  M3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<M3>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const M3& from);
-  void MergeFrom(const M3& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const M3& from) {
+    M3::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(M3* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "M3";
   }
+  protected:
+  explicit M3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kORFieldNumber = 1,
+  };
   // bytes OR = 1;
   void clear_or_();
-  static const int kORFieldNumber = 1;
-  const ::std::string& or_() const;
-  void set_or_(const ::std::string& value);
-  #if LANG_CXX11
-  void set_or_(::std::string&& value);
-  #endif
-  void set_or_(const char* value);
-  void set_or_(const void* value, size_t size);
-  ::std::string* mutable_or_();
-  ::std::string* release_or_();
-  void set_allocated_or_(::std::string* or_);
+  const std::string& or_() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_or_(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_or_();
+  PROTOBUF_NODISCARD std::string* release_or_();
+  void set_allocated_or_(std::string* or_);
+  private:
+  const std::string& _internal_or_() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_or_(const std::string& value);
+  std::string* _internal_mutable_or_();
+  public:
 
   // @@protoc_insertion_point(class_scope:M3)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr or__;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr or__;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateImage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:UpdateImage) */ {
+class UpdateImage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:UpdateImage) */ {
  public:
-  UpdateImage();
-  virtual ~UpdateImage();
+  inline UpdateImage() : UpdateImage(nullptr) {}
+  ~UpdateImage() override;
+  explicit PROTOBUF_CONSTEXPR UpdateImage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdateImage(const UpdateImage& from);
-
-  inline UpdateImage& operator=(const UpdateImage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   UpdateImage(UpdateImage&& from) noexcept
     : UpdateImage() {
     *this = ::std::move(from);
   }
 
+  inline UpdateImage& operator=(const UpdateImage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline UpdateImage& operator=(UpdateImage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UpdateImage& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateImage& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const UpdateImage* internal_default_instance() {
     return reinterpret_cast<const UpdateImage*>(
                &_UpdateImage_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(UpdateImage* other);
   friend void swap(UpdateImage& a, UpdateImage& b) {
     a.Swap(&b);
   }
+  inline void Swap(UpdateImage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateImage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateImage* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  UpdateImage* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  UpdateImage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateImage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdateImage& from);
-  void MergeFrom(const UpdateImage& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateImage& from) {
+    UpdateImage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(UpdateImage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "UpdateImage";
   }
+  protected:
+  explicit UpdateImage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSKFieldNumber = 2,
+    kSizeFieldNumber = 1,
+  };
+  // bytes SK = 2;
+  void clear_sk();
+  const std::string& sk() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sk(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sk();
+  PROTOBUF_NODISCARD std::string* release_sk();
+  void set_allocated_sk(std::string* sk);
+  private:
+  const std::string& _internal_sk() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sk(const std::string& value);
+  std::string* _internal_mutable_sk();
+  public:
+
   // uint32 size = 1;
   void clear_size();
-  static const int kSizeFieldNumber = 1;
-  ::google::protobuf::uint32 size() const;
-  void set_size(::google::protobuf::uint32 value);
+  uint32_t size() const;
+  void set_size(uint32_t value);
+  private:
+  uint32_t _internal_size() const;
+  void _internal_set_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:UpdateImage)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 size_;
-  mutable int _cached_size_;
-  friend struct protobuf_protocol_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sk_;
+    uint32_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
 #ifdef __GNUC__
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
@@ -1041,79 +1568,179 @@ class UpdateImage : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
 // uint32 V = 1;
 inline void UpdateCheck::clear_v() {
-  v_ = 0u;
+  _impl_.v_ = 0u;
 }
-inline ::google::protobuf::uint32 UpdateCheck::v() const {
+inline uint32_t UpdateCheck::_internal_v() const {
+  return _impl_.v_;
+}
+inline uint32_t UpdateCheck::v() const {
   // @@protoc_insertion_point(field_get:UpdateCheck.V)
-  return v_;
+  return _internal_v();
 }
-inline void UpdateCheck::set_v(::google::protobuf::uint32 value) {
+inline void UpdateCheck::_internal_set_v(uint32_t value) {
   
-  v_ = value;
+  _impl_.v_ = value;
+}
+inline void UpdateCheck::set_v(uint32_t value) {
+  _internal_set_v(value);
   // @@protoc_insertion_point(field_set:UpdateCheck.V)
 }
 
 // uint32 ID = 2;
 inline void UpdateCheck::clear_id() {
-  id_ = 0u;
+  _impl_.id_ = 0u;
 }
-inline ::google::protobuf::uint32 UpdateCheck::id() const {
+inline uint32_t UpdateCheck::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t UpdateCheck::id() const {
   // @@protoc_insertion_point(field_get:UpdateCheck.ID)
-  return id_;
+  return _internal_id();
 }
-inline void UpdateCheck::set_id(::google::protobuf::uint32 value) {
+inline void UpdateCheck::_internal_set_id(uint32_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
+}
+inline void UpdateCheck::set_id(uint32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:UpdateCheck.ID)
 }
 
+// bytes HI = 3;
+inline void UpdateCheck::clear_hi() {
+  _impl_.hi_.ClearToEmpty();
+}
+inline const std::string& UpdateCheck::hi() const {
+  // @@protoc_insertion_point(field_get:UpdateCheck.HI)
+  return _internal_hi();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateCheck::set_hi(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hi_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:UpdateCheck.HI)
+}
+inline std::string* UpdateCheck::mutable_hi() {
+  std::string* _s = _internal_mutable_hi();
+  // @@protoc_insertion_point(field_mutable:UpdateCheck.HI)
+  return _s;
+}
+inline const std::string& UpdateCheck::_internal_hi() const {
+  return _impl_.hi_.Get();
+}
+inline void UpdateCheck::_internal_set_hi(const std::string& value) {
+  
+  _impl_.hi_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateCheck::_internal_mutable_hi() {
+  
+  return _impl_.hi_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateCheck::release_hi() {
+  // @@protoc_insertion_point(field_release:UpdateCheck.HI)
+  return _impl_.hi_.Release();
+}
+inline void UpdateCheck::set_allocated_hi(std::string* hi) {
+  if (hi != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hi_.SetAllocated(hi, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hi_.IsDefault()) {
+    _impl_.hi_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:UpdateCheck.HI)
+}
+
 // -------------------------------------------------------------------
 
 // UpdateStatus
 
 // bool successful = 1;
 inline void UpdateStatus::clear_successful() {
-  successful_ = false;
+  _impl_.successful_ = false;
+}
+inline bool UpdateStatus::_internal_successful() const {
+  return _impl_.successful_;
 }
 inline bool UpdateStatus::successful() const {
   // @@protoc_insertion_point(field_get:UpdateStatus.successful)
-  return successful_;
+  return _internal_successful();
 }
-inline void UpdateStatus::set_successful(bool value) {
+inline void UpdateStatus::_internal_set_successful(bool value) {
   
-  successful_ = value;
+  _impl_.successful_ = value;
+}
+inline void UpdateStatus::set_successful(bool value) {
+  _internal_set_successful(value);
   // @@protoc_insertion_point(field_set:UpdateStatus.successful)
 }
 
+// bool parallel_auth = 2;
+inline void UpdateStatus::clear_parallel_auth() {
+  _impl_.parallel_auth_ = false;
+}
+inline bool UpdateStatus::_internal_parallel_auth() const {
+  return _impl_.parallel_auth_;
+}
+inline bool UpdateStatus::parallel_auth() const {
+  // @@protoc_insertion_point(field_get:UpdateStatus.parallel_auth)
+  return _internal_parallel_auth();
+}
+inline void UpdateStatus::_internal_set_parallel_auth(bool value) {
+  
+  _impl_.parallel_auth_ = value;
+}
+inline void UpdateStatus::set_parallel_auth(bool value) {
+  _internal_set_parallel_auth(value);
+  // @@protoc_insertion_point(field_set:UpdateStatus.parallel_auth)
+}
+
 // -------------------------------------------------------------------
 
 // OrgChallenge
 
 // uint64 NG = 1;
 inline void OrgChallenge::clear_ng() {
-  ng_ = GOOGLE_ULONGLONG(0);
+  _impl_.ng_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 OrgChallenge::ng() const {
+inline uint64_t OrgChallenge::_internal_ng() const {
+  return _impl_.ng_;
+}
+inline uint64_t OrgChallenge::ng() const {
   // @@protoc_insertion_point(field_get:OrgChallenge.NG)
-  return ng_;
+  return _internal_ng();
 }
-inline void OrgChallenge::set_ng(::google::protobuf::uint64 value) {
+inline void OrgChallenge::_internal_set_ng(uint64_t value) {
   
-  ng_ = value;
+  _impl_.ng_ = value;
+}
+inline void OrgChallenge::set_ng(uint64_t value) {
+  _internal_set_ng(value);
   // @@protoc_insertion_point(field_set:OrgChallenge.NG)
 }
 
 // uint32 IG = 2;
 inline void OrgChallenge::clear_ig() {
-  ig_ = 0u;
+  _impl_.ig_ = 0u;
+}
+inline uint32_t OrgChallenge::_internal_ig() const {
+  return _impl_.ig_;
 }
-inline ::google::protobuf::uint32 OrgChallenge::ig() const {
+inline uint32_t OrgChallenge::ig() const {
   // @@protoc_insertion_point(field_get:OrgChallenge.IG)
-  return ig_;
+  return _internal_ig();
 }
-inline void OrgChallenge::set_ig(::google::protobuf::uint32 value) {
+inline void OrgChallenge::_internal_set_ig(uint32_t value) {
   
-  ig_ = value;
+  _impl_.ig_ = value;
+}
+inline void OrgChallenge::set_ig(uint32_t value) {
+  _internal_set_ig(value);
   // @@protoc_insertion_point(field_set:OrgChallenge.IG)
 }
 
@@ -1123,43 +1750,61 @@ inline void OrgChallenge::set_ig(::google::protobuf::uint32 value) {
 
 // uint64 NG = 1;
 inline void DeviceChallenge::clear_ng() {
-  ng_ = GOOGLE_ULONGLONG(0);
+  _impl_.ng_ = uint64_t{0u};
+}
+inline uint64_t DeviceChallenge::_internal_ng() const {
+  return _impl_.ng_;
 }
-inline ::google::protobuf::uint64 DeviceChallenge::ng() const {
+inline uint64_t DeviceChallenge::ng() const {
   // @@protoc_insertion_point(field_get:DeviceChallenge.NG)
-  return ng_;
+  return _internal_ng();
 }
-inline void DeviceChallenge::set_ng(::google::protobuf::uint64 value) {
+inline void DeviceChallenge::_internal_set_ng(uint64_t value) {
   
-  ng_ = value;
+  _impl_.ng_ = value;
+}
+inline void DeviceChallenge::set_ng(uint64_t value) {
+  _internal_set_ng(value);
   // @@protoc_insertion_point(field_set:DeviceChallenge.NG)
 }
 
 // uint64 ND = 2;
 inline void DeviceChallenge::clear_nd() {
-  nd_ = GOOGLE_ULONGLONG(0);
+  _impl_.nd_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 DeviceChallenge::nd() const {
+inline uint64_t DeviceChallenge::_internal_nd() const {
+  return _impl_.nd_;
+}
+inline uint64_t DeviceChallenge::nd() const {
   // @@protoc_insertion_point(field_get:DeviceChallenge.ND)
-  return nd_;
+  return _internal_nd();
 }
-inline void DeviceChallenge::set_nd(::google::protobuf::uint64 value) {
+inline void DeviceChallenge::_internal_set_nd(uint64_t value) {
   
-  nd_ = value;
+  _impl_.nd_ = value;
+}
+inline void DeviceChallenge::set_nd(uint64_t value) {
+  _internal_set_nd(value);
   // @@protoc_insertion_point(field_set:DeviceChallenge.ND)
 }
 
 // uint32 ID = 3;
 inline void DeviceChallenge::clear_id() {
-  id_ = 0u;
+  _impl_.id_ = 0u;
+}
+inline uint32_t DeviceChallenge::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::uint32 DeviceChallenge::id() const {
+inline uint32_t DeviceChallenge::id() const {
   // @@protoc_insertion_point(field_get:DeviceChallenge.ID)
-  return id_;
+  return _internal_id();
 }
-inline void DeviceChallenge::set_id(::google::protobuf::uint32 value) {
+inline void DeviceChallenge::_internal_set_id(uint32_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
+}
+inline void DeviceChallenge::set_id(uint32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:DeviceChallenge.ID)
 }
 
@@ -1169,82 +1814,91 @@ inline void DeviceChallenge::set_id(::google::protobuf::uint32 value) {
 
 // uint64 ND = 1;
 inline void OrgResponse::clear_nd() {
-  nd_ = GOOGLE_ULONGLONG(0);
+  _impl_.nd_ = uint64_t{0u};
+}
+inline uint64_t OrgResponse::_internal_nd() const {
+  return _impl_.nd_;
 }
-inline ::google::protobuf::uint64 OrgResponse::nd() const {
+inline uint64_t OrgResponse::nd() const {
   // @@protoc_insertion_point(field_get:OrgResponse.ND)
-  return nd_;
+  return _internal_nd();
 }
-inline void OrgResponse::set_nd(::google::protobuf::uint64 value) {
+inline void OrgResponse::_internal_set_nd(uint64_t value) {
   
-  nd_ = value;
+  _impl_.nd_ = value;
+}
+inline void OrgResponse::set_nd(uint64_t value) {
+  _internal_set_nd(value);
   // @@protoc_insertion_point(field_set:OrgResponse.ND)
 }
 
 // uint32 IG = 2;
 inline void OrgResponse::clear_ig() {
-  ig_ = 0u;
+  _impl_.ig_ = 0u;
 }
-inline ::google::protobuf::uint32 OrgResponse::ig() const {
+inline uint32_t OrgResponse::_internal_ig() const {
+  return _impl_.ig_;
+}
+inline uint32_t OrgResponse::ig() const {
   // @@protoc_insertion_point(field_get:OrgResponse.IG)
-  return ig_;
+  return _internal_ig();
 }
-inline void OrgResponse::set_ig(::google::protobuf::uint32 value) {
+inline void OrgResponse::_internal_set_ig(uint32_t value) {
   
-  ig_ = value;
+  _impl_.ig_ = value;
+}
+inline void OrgResponse::set_ig(uint32_t value) {
+  _internal_set_ig(value);
   // @@protoc_insertion_point(field_set:OrgResponse.IG)
 }
 
 // bytes HC = 3;
 inline void OrgResponse::clear_hc() {
-  hc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.hc_.ClearToEmpty();
 }
-inline const ::std::string& OrgResponse::hc() const {
+inline const std::string& OrgResponse::hc() const {
   // @@protoc_insertion_point(field_get:OrgResponse.HC)
-  return hc_.GetNoArena();
+  return _internal_hc();
 }
-inline void OrgResponse::set_hc(const ::std::string& value) {
-  
-  hc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OrgResponse::set_hc(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hc_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OrgResponse.HC)
 }
-#if LANG_CXX11
-inline void OrgResponse::set_hc(::std::string&& value) {
-  
-  hc_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:OrgResponse.HC)
+inline std::string* OrgResponse::mutable_hc() {
+  std::string* _s = _internal_mutable_hc();
+  // @@protoc_insertion_point(field_mutable:OrgResponse.HC)
+  return _s;
 }
-#endif
-inline void OrgResponse::set_hc(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  hc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:OrgResponse.HC)
+inline const std::string& OrgResponse::_internal_hc() const {
+  return _impl_.hc_.Get();
 }
-inline void OrgResponse::set_hc(const void* value, size_t size) {
+inline void OrgResponse::_internal_set_hc(const std::string& value) {
   
-  hc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:OrgResponse.HC)
+  _impl_.hc_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* OrgResponse::mutable_hc() {
+inline std::string* OrgResponse::_internal_mutable_hc() {
   
-  // @@protoc_insertion_point(field_mutable:OrgResponse.HC)
-  return hc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hc_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* OrgResponse::release_hc() {
+inline std::string* OrgResponse::release_hc() {
   // @@protoc_insertion_point(field_release:OrgResponse.HC)
-  
-  return hc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hc_.Release();
 }
-inline void OrgResponse::set_allocated_hc(::std::string* hc) {
-  if (hc != NULL) {
+inline void OrgResponse::set_allocated_hc(std::string* hc) {
+  if (hc != nullptr) {
     
   } else {
     
   }
-  hc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hc);
+  _impl_.hc_.SetAllocated(hc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hc_.IsDefault()) {
+    _impl_.hc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OrgResponse.HC)
 }
 
@@ -1254,68 +1908,71 @@ inline void OrgResponse::set_allocated_hc(::std::string* hc) {
 
 // uint32 V = 1;
 inline void M1::clear_v() {
-  v_ = 0u;
+  _impl_.v_ = 0u;
 }
-inline ::google::protobuf::uint32 M1::v() const {
+inline uint32_t M1::_internal_v() const {
+  return _impl_.v_;
+}
+inline uint32_t M1::v() const {
   // @@protoc_insertion_point(field_get:M1.V)
-  return v_;
+  return _internal_v();
 }
-inline void M1::set_v(::google::protobuf::uint32 value) {
+inline void M1::_internal_set_v(uint32_t value) {
   
-  v_ = value;
+  _impl_.v_ = value;
+}
+inline void M1::set_v(uint32_t value) {
+  _internal_set_v(value);
   // @@protoc_insertion_point(field_set:M1.V)
 }
 
 // bytes OC = 2;
 inline void M1::clear_oc() {
-  oc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.oc_.ClearToEmpty();
 }
-inline const ::std::string& M1::oc() const {
+inline const std::string& M1::oc() const {
   // @@protoc_insertion_point(field_get:M1.OC)
-  return oc_.GetNoArena();
+  return _internal_oc();
 }
-inline void M1::set_oc(const ::std::string& value) {
-  
-  oc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void M1::set_oc(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.oc_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:M1.OC)
 }
-#if LANG_CXX11
-inline void M1::set_oc(::std::string&& value) {
-  
-  oc_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:M1.OC)
+inline std::string* M1::mutable_oc() {
+  std::string* _s = _internal_mutable_oc();
+  // @@protoc_insertion_point(field_mutable:M1.OC)
+  return _s;
 }
-#endif
-inline void M1::set_oc(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  oc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:M1.OC)
+inline const std::string& M1::_internal_oc() const {
+  return _impl_.oc_.Get();
 }
-inline void M1::set_oc(const void* value, size_t size) {
+inline void M1::_internal_set_oc(const std::string& value) {
   
-  oc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:M1.OC)
+  _impl_.oc_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* M1::mutable_oc() {
+inline std::string* M1::_internal_mutable_oc() {
   
-  // @@protoc_insertion_point(field_mutable:M1.OC)
-  return oc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.oc_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* M1::release_oc() {
+inline std::string* M1::release_oc() {
   // @@protoc_insertion_point(field_release:M1.OC)
-  
-  return oc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.oc_.Release();
 }
-inline void M1::set_allocated_oc(::std::string* oc) {
-  if (oc != NULL) {
+inline void M1::set_allocated_oc(std::string* oc) {
+  if (oc != nullptr) {
     
   } else {
     
   }
-  oc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), oc);
+  _impl_.oc_.SetAllocated(oc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.oc_.IsDefault()) {
+    _impl_.oc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:M1.OC)
 }
 
@@ -1325,54 +1982,51 @@ inline void M1::set_allocated_oc(::std::string* oc) {
 
 // bytes DC = 1;
 inline void M2::clear_dc() {
-  dc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.dc_.ClearToEmpty();
 }
-inline const ::std::string& M2::dc() const {
+inline const std::string& M2::dc() const {
   // @@protoc_insertion_point(field_get:M2.DC)
-  return dc_.GetNoArena();
+  return _internal_dc();
 }
-inline void M2::set_dc(const ::std::string& value) {
-  
-  dc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void M2::set_dc(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.dc_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:M2.DC)
 }
-#if LANG_CXX11
-inline void M2::set_dc(::std::string&& value) {
-  
-  dc_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:M2.DC)
+inline std::string* M2::mutable_dc() {
+  std::string* _s = _internal_mutable_dc();
+  // @@protoc_insertion_point(field_mutable:M2.DC)
+  return _s;
 }
-#endif
-inline void M2::set_dc(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  dc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:M2.DC)
+inline const std::string& M2::_internal_dc() const {
+  return _impl_.dc_.Get();
 }
-inline void M2::set_dc(const void* value, size_t size) {
+inline void M2::_internal_set_dc(const std::string& value) {
   
-  dc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:M2.DC)
+  _impl_.dc_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* M2::mutable_dc() {
+inline std::string* M2::_internal_mutable_dc() {
   
-  // @@protoc_insertion_point(field_mutable:M2.DC)
-  return dc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.dc_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* M2::release_dc() {
+inline std::string* M2::release_dc() {
   // @@protoc_insertion_point(field_release:M2.DC)
-  
-  return dc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.dc_.Release();
 }
-inline void M2::set_allocated_dc(::std::string* dc) {
-  if (dc != NULL) {
+inline void M2::set_allocated_dc(std::string* dc) {
+  if (dc != nullptr) {
     
   } else {
     
   }
-  dc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dc);
+  _impl_.dc_.SetAllocated(dc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dc_.IsDefault()) {
+    _impl_.dc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:M2.DC)
 }
 
@@ -1382,54 +2036,51 @@ inline void M2::set_allocated_dc(::std::string* dc) {
 
 // bytes OR = 1;
 inline void M3::clear_or_() {
-  or__.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.or__.ClearToEmpty();
 }
-inline const ::std::string& M3::or_() const {
+inline const std::string& M3::or_() const {
   // @@protoc_insertion_point(field_get:M3.OR)
-  return or__.GetNoArena();
+  return _internal_or_();
 }
-inline void M3::set_or_(const ::std::string& value) {
-  
-  or__.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void M3::set_or_(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.or__.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:M3.OR)
 }
-#if LANG_CXX11
-inline void M3::set_or_(::std::string&& value) {
-  
-  or__.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:M3.OR)
+inline std::string* M3::mutable_or_() {
+  std::string* _s = _internal_mutable_or_();
+  // @@protoc_insertion_point(field_mutable:M3.OR)
+  return _s;
 }
-#endif
-inline void M3::set_or_(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  or__.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:M3.OR)
+inline const std::string& M3::_internal_or_() const {
+  return _impl_.or__.Get();
 }
-inline void M3::set_or_(const void* value, size_t size) {
+inline void M3::_internal_set_or_(const std::string& value) {
   
-  or__.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:M3.OR)
+  _impl_.or__.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* M3::mutable_or_() {
+inline std::string* M3::_internal_mutable_or_() {
   
-  // @@protoc_insertion_point(field_mutable:M3.OR)
-  return or__.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.or__.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* M3::release_or_() {
+inline std::string* M3::release_or_() {
   // @@protoc_insertion_point(field_release:M3.OR)
-  
-  return or__.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.or__.Release();
 }
-inline void M3::set_allocated_or_(::std::string* or_) {
-  if (or_ != NULL) {
+inline void M3::set_allocated_or_(std::string* or_) {
+  if (or_ != nullptr) {
     
   } else {
     
   }
-  or__.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), or_);
+  _impl_.or__.SetAllocated(or_, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.or__.IsDefault()) {
+    _impl_.or__.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:M3.OR)
 }
 
@@ -1439,22 +2090,77 @@ inline void M3::set_allocated_or_(::std::string* or_) {
 
 // uint32 size = 1;
 inline void UpdateImage::clear_size() {
-  size_ = 0u;
+  _impl_.size_ = 0u;
+}
+inline uint32_t UpdateImage::_internal_size() const {
+  return _impl_.size_;
 }
-inline ::google::protobuf::uint32 UpdateImage::size() const {
+inline uint32_t UpdateImage::size() const {
   // @@protoc_insertion_point(field_get:UpdateImage.size)
-  return size_;
+  return _internal_size();
 }
-inline void UpdateImage::set_size(::google::protobuf::uint32 value) {
+inline void UpdateImage::_internal_set_size(uint32_t value) {
   
-  size_ = value;
+  _impl_.size_ = value;
+}
+inline void UpdateImage::set_size(uint32_t value) {
+  _internal_set_size(value);
   // @@protoc_insertion_point(field_set:UpdateImage.size)
 }
 
+// bytes SK = 2;
+inline void UpdateImage::clear_sk() {
+  _impl_.sk_.ClearToEmpty();
+}
+inline const std::string& UpdateImage::sk() const {
+  // @@protoc_insertion_point(field_get:UpdateImage.SK)
+  return _internal_sk();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateImage::set_sk(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sk_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:UpdateImage.SK)
+}
+inline std::string* UpdateImage::mutable_sk() {
+  std::string* _s = _internal_mutable_sk();
+  // @@protoc_insertion_point(field_mutable:UpdateImage.SK)
+  return _s;
+}
+inline const std::string& UpdateImage::_internal_sk() const {
+  return _impl_.sk_.Get();
+}
+inline void UpdateImage::_internal_set_sk(const std::string& value) {
+  
+  _impl_.sk_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateImage::_internal_mutable_sk() {
+  
+  return _impl_.sk_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateImage::release_sk() {
+  // @@protoc_insertion_point(field_release:UpdateImage.SK)
+  return _impl_.sk_.Release();
+}
+inline void UpdateImage::set_allocated_sk(std::string* sk) {
+  if (sk != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sk_.SetAllocated(sk, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sk_.IsDefault()) {
+    _impl_.sk_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:UpdateImage.SK)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1477,4 +2183,5 @@ inline void UpdateImage::set_size(::google::protobuf::uint32 value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_protocol_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_protocol_2eproto
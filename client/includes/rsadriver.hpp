@@ -4,9 +4,12 @@
 #include <vector>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 
 #include "axidriver.hpp" // for AXIDriver class
-#include "utils.hpp" // for IntSplitter and swap_bytes()
+#include "bignum.hpp" // for Montgomery
+#include "rsascheduler.hpp" // for RSAScheduler
+#include "utils.hpp" // for swap_bytes() and append_word()
 
 #define RSA_BASE_ADDR     FPGA_BASE_ADDR + 0x3C00000
 
@@ -24,29 +27,77 @@
 // PKCS#1 1.5 padding size
 #define PKCS1_PAD_SIZE 11
 
+// Number of key slots configured in the PL (slot 0 is unused)
+#define RSA_KEY_SLOTS 7
+
 // Indices of required keys as configured in PL (see RSA AXI driver implementation)
 enum RSAKey {
     D_PRV = 1, // Device private key (decryption)
+    D_PUB = 4, // Device public key (encryption, e.g., for benchmarks)
     GU_PUB = 5, // Updating org public key (encryption)
     GC_PUB = 6  // Confirming org public key (encryption)
+    // Further confirming org keys can be loaded into the following slots (see config.hpp)
 };
 
+// Thread safety: see AXIDriver. Drivers on different threads share the core
+// through scheduler(), one chunk at a time, and the read-only software key
+// contexts. PKCS#1 salts come from the thread's CSPRNG (csprng.hpp).
 class RSADriver : public AXIDriver {
 public:
-    RSADriver() : AXIDriver(RSA_BASE_ADDR) {}
-    std::string decrypt(const std::string& ciphertext);
-    std::string encrypt(const std::string& plaintext, RSAKey key);
+    RSADriver() : AXIDriver(RSA_BASE_ADDR, counters) {}
+
+    // Counters shared by all RSA driver instances
+    static DriverStats counters;
+
+    // Counters of chunks encrypted in software instead of on the core
+    static DriverStats software_counters;
+
+    // There is a single RSA core: drivers on different threads take turns, one
+    // chunk at a time, in the order of their priority
+    static RSAScheduler& scheduler();
+
+    std::string decrypt(const std::string& ciphertext, bool is_final = true);
+
+    // The last chunk of a final plaintext always carries the length padding,
+    // in a chunk of its own if the plaintext fills its chunks. Other parts of
+    // a message must be whole chunks.
+    std::string encrypt(const std::string& plaintext, RSAKey key, bool is_final = true);
+
+    // Same, writing the result into a caller's string so its memory is reused
+    void decrypt(const std::string& ciphertext, std::string& plaintext, bool is_final = true);
+    void decrypt(const char* ciphertext, size_t size, std::string& plaintext, bool is_final = true);
+    void encrypt(const std::string& plaintext, RSAKey key, std::string& ciphertext, bool is_final = true);
     bool pkcs1 = true;
+
+    // Priority of this driver's chunks on the core (BULK for image decryption)
+    RSAPriority priority = RSAPriority::INTERACTIVE;
+
+    // Sets the modulus (hex) of the public key in the given slot (pubkey in
+    // updater.conf). Encryption to the slot then runs in software, which is
+    // quicker than a round trip to the core and leaves the core to decryption.
+    // The modulus must be that of the key loaded into the PL; slots without one
+    // still use the core. Must be called before drivers are used by other
+    // threads. Returns false for an invalid slot.
+    static bool set_public_key(RSAKey key, const std::string& modulus);
 private:
-    // Encrypts or decrypts given data, based on provided key
-    std::string compute_rsa(const std::string& data, RSAKey key);
+    // Encrypts or decrypts a 64 byte chunk, based on provided key
+    void compute_rsa(const uint8_t* data, RSAKey key, uint8_t* result);
+
+    // Encrypts a padded chunk under a public key, in software if possible
+    void encrypt_chunk(const uint8_t* data, RSAKey key, uint8_t* result);
+
+    // Returns the software context of a public key, or NULL if only the core has it
+    static const Montgomery* public_key(RSAKey key);
+
+    // Software contexts of the public keys by slot, set up by set_public_key()
+    static std::unique_ptr<Montgomery> public_keys[RSA_KEY_SLOTS];
 
-    // Strip PKCS#1 v1.5 padding from a given decrypted plaintext
-    std::string strip_pkcs1_padding(const std::string& plaintext, bool is_last);
+    // Strips PKCS#1 v1.5 padding from a decrypted chunk and appends the data to plaintext
+    void strip_pkcs1_padding(const uint8_t* decrypted, bool is_last, std::string& plaintext);
 
     // Write a single 512 bit chunk
-    void write_chunk(const std::string& chunk);
+    void write_chunk(const uint8_t* chunk);
 
     // Read a single 512 bit chunk
-    void read_chunk(std::string& chunk);
+    void read_chunk(uint8_t* chunk);
 };
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include "rsadriver.hpp" // for RSA_KEY_SLOTS
+
+// Development RSA-512 keys as loaded into the PL key slots (see server/rsakeys.py),
+// including the private exponents. Only for the host simulation of the RSA core
+// (simulation.cpp) and the tests: device code must not include this header.
+// Public moduli for the software encryption path come from updater.conf.
+
+#define D_MODULUS  "81b64773fc0750bc6783c7df0a64391d61392757ecf598fe6fc9097dfd1c061f8f98ced8ec329dae4af493bbc771db160c69591096e3c11bc4888b260757b0ad"
+#define GU_MODULUS "b9f6ed5da91e1c7d672a29f0616e4685f4d9d3a27e7e1308a40e33c6a6ec12164a4593816ea09656baa73f4709b24ad325b8e1311f4510706d3b414df4356869"
+#define GC_MODULUS "9a38104602e2f0b2383453f98c0c024f6e8531f58a2ebe54708b71a324ee4277a12ed53cf03da9e0ebec49fcc5e3db73316db7fba370bcaefc2d74eb24cee03b"
+
+struct RSAKeySlot {
+    const char* modulus;  // n in hex
+    const char* exponent; // e or d in hex
+};
+
+// Indexed by key slot (slot 0 is unused)
+const RSAKeySlot RSA_KEY_TABLE[RSA_KEY_SLOTS] = {
+    {NULL, NULL},
+    // 1: D_prv
+    {D_MODULUS,
+     "2fc8c5b3dda198457fe0d52dbe77436f2654d6c09663b793ebfc6489cc47412b2534ea7bd9a3a4de26262729b6b31f7354f42ee12469f0353f0b1277a0c44921"},
+    // 2: GU_prv
+    {GU_MODULUS,
+     "829070b54ab09e7619418c327e658b542fc5e405f96390ff871785989ac7214a8b4fcf59369998a64c43c31e30089ca5de7a20f229bb1e30704c09bcf71eea81"},
+    // 3: GC_prv
+    {GC_MODULUS,
+     "1446f4d4cfc2591585d0538e473cb8fd0ab216ac8b3bb428d417719c9ad961dcc23d96026b4c30231333245b4fa90d9440298483ef14e1195ee5c27cb3627a51"},
+    // 4: D_pub
+    {D_MODULUS,
+     "10001"},
+    // 5: GU_pub
+    {GU_MODULUS,
+     "10001"},
+    // 6: GC_pub
+    {GC_MODULUS,
+     "10001"}
+};
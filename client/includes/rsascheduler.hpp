@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <mutex>
+#include <condition_variable>
+
+// Priority classes of work on the RSA core (lower value runs first)
+enum RSAPriority {
+    INTERACTIVE = 0, // Protocol messages: orgs time out if these wait too long
+    BULK = 1         // Image decryption
+};
+
+#define RSA_PRIORITY_CLASSES 2
+
+// Core usage of one priority class
+struct SchedulerStats {
+    uint64_t grants = 0;    // Chunks run on the core
+    uint64_t waits = 0;     // Grants that had to wait for the core
+    uint64_t wait_time = 0; // Total time spent waiting (microseconds)
+    uint64_t max_wait = 0;  // Longest wait (microseconds)
+    uint32_t max_depth = 0; // Most requests queued at once
+};
+
+// Hands out the RSA core one chunk at a time. Waiting interactive requests
+// always get the core before waiting bulk requests, so protocol operations
+// overtake an image decryption at the next chunk boundary. Requests of the
+// same class are served in arrival order.
+class RSAScheduler {
+public:
+    // Blocks until the core is free and it is this request's turn
+    void acquire(RSAPriority priority);
+
+    // Hands the core to the next request
+    void release();
+
+    // Holds the core for the lifetime of the object
+    class Grant {
+    public:
+        Grant(RSAScheduler& scheduler, RSAPriority priority) : scheduler(scheduler) {
+            scheduler.acquire(priority);
+        }
+
+        ~Grant() {
+            scheduler.release();
+        }
+    private:
+        RSAScheduler& scheduler;
+    };
+
+    // Requests of the class currently waiting for the core
+    uint32_t queued(RSAPriority priority) const;
+
+    SchedulerStats get_stats(RSAPriority priority) const;
+
+    void reset();
+    void print(std::ostream& out) const;
+private:
+    mutable std::mutex lock;
+    std::condition_variable available;
+    bool busy = false;
+
+    // Per class: tickets handed out and the next ticket to serve (FIFO order)
+    uint64_t next_ticket[RSA_PRIORITY_CLASSES] = {0, 0};
+    uint64_t next_served[RSA_PRIORITY_CLASSES] = {0, 0};
+
+    SchedulerStats stats[RSA_PRIORITY_CLASSES];
+};
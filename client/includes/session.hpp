@@ -0,0 +1,205 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+#define ASIO_STANDALONE // Do not use Boost
+#include "asio.hpp"
+
+// Protocol messages are either the generated protobuf classes or, with
+// WIRE_CODEC (make CODEC=wire), the hand-written codec in wire.hpp
+#ifdef WIRE_CODEC
+    #include "wire.hpp"
+
+    typedef WireArena SessionArena;
+    typedef WireArenaOptions SessionArenaOptions;
+#else
+    #include <google/protobuf/arena.h>
+
+    typedef google::protobuf::Arena SessionArena;
+    typedef google::protobuf::ArenaOptions SessionArenaOptions;
+#endif
+
+#include "rsadriver.hpp" // for RSAKey
+
+// Size of the block each session allocates its messages and buffers from. A
+// run of the protocol fits in it, so the arena only goes to the heap when a
+// run needs more (it then adds blocks that are freed when the run ends).
+#define SESSION_ARENA_SIZE 8192
+
+enum Org {
+    GU,
+    GC
+};
+
+// A confirming org G_C,i: where it listens and the RSA core key slot holding its public key
+struct ConfirmingOrg {
+    asio::ip::tcp::endpoint endpoint;
+    RSAKey key;
+};
+
+// Device side of the update protocol over a single server connection:
+// UpdateCheck, then one authentication run per organization. Used by the
+// updater itself and by the load generator (tools/loadgen.cpp).
+class UpdateSession {
+public:
+    UpdateSession(asio::ip::tcp::socket& socket, uint32_t id, uint32_t version)
+        : socket(socket), id(id), version(version), arena(arena_options(arena_block)) {}
+
+    // Sends the UpdateCheck message announcing the device ID, version and installed image
+    void send_update_check();
+
+    // Sends the UpdateCheck and receives the server's UpdateStatus. Returns
+    // true if an update is available; otherwise sets up_to_date, unless the
+    // reply was invalid. Doesn't use the crypto cores.
+    bool check_for_update();
+
+    // Runs the protocol for the given org, after check_for_update(). For G_U
+    // the update image is received as well; for G_C, hash is set to its
+    // confirming hash.
+    bool run_protocol(Org org, std::string& hash);
+
+    // Same, encrypting to the org public key in the given key slot
+    bool run_protocol(Org org, std::string& hash, RSAKey key);
+
+    // Receives image_size bytes of update image and acknowledges them
+    void receive_image(uint32_t image_size);
+
+    // Whether protocol messages are encrypted (must match the server's ENCRYPT)
+    bool encrypt = true;
+
+    // Whether they are decrypted and encrypted on the crypto broker's core
+    // (BrokerEncrypted, see policy.hpp) instead of through RSADriver
+    bool broker = false;
+
+    // File the update image is written to (NULL discards the image)
+    const char* image_path = NULL;
+
+    // Header hash of the installed image, empty if there is none. The server
+    // only sends a delta image that was built against this image
+    std::string installed_hash;
+
+    // Set by check_for_update() if the server replied that the device is up to date
+    bool up_to_date = false;
+
+    // Set by check_for_update() from the server's reply: whether each G_C,i is
+    // authenticated on its own connection (ConfirmingOrgs), concurrently with
+    // G_U, or after G_U over this connection
+    bool parallel_auth = false;
+
+    // Version of the update, from G_U's M1
+    uint32_t update_version = 0;
+
+    // Size of the received update image
+    uint32_t image_size = 0;
+
+    // Time spent receiving the update image (seconds)
+    double image_time = 0;
+
+    // Session key (key || nonce) for images encrypted in hybrid mode, empty otherwise
+    std::string session_key;
+
+    // Called by G_U once the image size is known, before the download starts.
+    // Returning false ends the session without downloading the image
+    std::function<bool()> confirm_image;
+private:
+    asio::ip::tcp::socket& socket;
+
+    const uint32_t id;
+    const uint32_t version;
+
+    // Protocol messages and receive buffers of a run are allocated from the
+    // arena, which is reset when the run ends. Its first block is part of
+    // the session, so a run needs no heap allocations of its own.
+    alignas(8) char arena_block[SESSION_ARENA_SIZE];
+    SessionArena arena;
+
+    static SessionArenaOptions arena_options(char* block);
+
+    // Receive buffer for protocol messages (in the arena)
+    char* buf = NULL;
+
+    // Received bytes that belong to the next message (in buf)
+    const char* pending_data = NULL;
+    size_t pending_size = 0;
+
+    // Serialized DeviceChallenge and RSA results, reused across runs
+    std::string message;
+    std::string plaintext;
+    std::string ciphertext;
+
+    // Runs the protocol, allocating from the arena (Encryption: see policy.hpp)
+    template <typename Encryption>
+    bool exchange_messages(Org org, std::string& hash, RSAKey key);
+
+    // Receives a single protocol message into buf and returns its size
+    size_t receive_message(const char*& data);
+};
+
+// Runs the G_C protocol with each confirming org on its own connection and
+// thread, so the orgs are authenticated while the G_U session downloads the
+// image. The caller continues once a quorum of orgs agree on the hash; orgs
+// still running then are cancelled.
+class ConfirmingOrgs {
+public:
+    ConfirmingOrgs(uint32_t id, uint32_t version) : id(id), version(version) {}
+
+    // Cancels and waits for any orgs still running
+    ~ConfirmingOrgs();
+
+    // Starts one session per org
+    void start(const std::vector<ConfirmingOrg>& orgs);
+
+    // Waits until quorum orgs returned the same confirming hash, and sets
+    // hashes to theirs. Returns false as soon as no hash can reach the quorum
+    bool wait_for_quorum(uint32_t quorum, std::vector<std::string>& hashes);
+
+    // Stops the orgs still running (their results are no longer needed)
+    void cancel();
+
+    // Whether the sessions encrypt protocol messages, and whether on the
+    // crypto broker's core (set before start())
+    bool encrypt = true;
+    bool broker = false;
+
+    // Set after wait_for_quorum() if an org replied that the device is up to date
+    bool up_to_date = false;
+private:
+    enum OrgState {
+        RUNNING,
+        SUCCEEDED,
+        FAILED,
+        UP_TO_DATE // Org replied that the device is up to date
+    };
+
+    const uint32_t id;
+    const uint32_t version;
+
+    std::vector<std::thread> threads;
+
+    // Per-org results and sockets, guarded by lock
+    std::mutex lock;
+    std::condition_variable finished;
+    std::vector<OrgState> states;
+    std::vector<std::string> org_hashes;
+    std::vector<asio::ip::tcp::socket*> sockets;
+    bool cancelled = false;
+
+    // Runs the protocol with org i (on its own thread)
+    void run_org(size_t i, const ConfirmingOrg& org);
+};
+
+// Parses a length-delimited UpdateStatus at the start of data and sets available
+// and parallel_auth to its fields. Returns its size, or 0 if it is incomplete or invalid
+size_t parse_update_status(const char* data, size_t size, bool& available, bool& parallel_auth);
+
+// Returns the largest number of equal hashes and sets hash to that value
+uint32_t count_matching(const std::vector<std::string>& hashes, std::string& hash);
+
+// Confirming orgs at the ports following a G_U endpoint, all using the G_C key slot
+std::vector<ConfirmingOrg> default_confirming_orgs(const asio::ip::tcp::endpoint& gu_endpoint, uint32_t num_orgs);
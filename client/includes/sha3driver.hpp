@@ -3,9 +3,10 @@
 #include <string>
 #include <cstdint>
 #include <cstring>
+#include <mutex>
 
 #include "axidriver.hpp" // for AXIDriver class
-#include "utils.hpp" // for IntSplitter and swap_bytes()
+#include "utils.hpp" // for swap_bytes() and append_word()
 
 #define SHA3_BASE_ADDR   FPGA_BASE_ADDR + 0x3C20000
 #define HASH_BASE_ADDR   FPGA_BASE_ADDR + 0x3C10000
@@ -25,12 +26,39 @@
 
 const char hex[16] = {'0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f'};
 
+// Thread safety: see AXIDriver. The SHA-3 core keeps the state of one hash from
+// begin() to finalize(), so a driver holds the core for that long and drivers
+// on other threads wait in begin(). Finish (or destroy) one hash before
+// starting another on the same thread.
 class SHA3Driver : public AXIDriver {
 public:
-    SHA3Driver() : AXIDriver(SHA3_BASE_ADDR) {}
+    SHA3Driver() : AXIDriver(SHA3_BASE_ADDR, counters) {}
+
+    // Counters shared by all SHA-3 driver instances
+    static DriverStats counters;
+
+    // Held by the driver whose hash is in progress on the core
+    static std::mutex& core_lock();
+
     void reset();
     std::string compute_hash(std::string& data, bool readable);
+
+    // Streaming interface: begin(), any number of update() calls, then finalize()
+    void begin();
+    void update(const char* data, size_t length);
+    std::string finalize(bool readable);
 private:
+    // Owns core_lock() between begin() and finalize()
+    std::unique_lock<std::mutex> core;
+
+    // Bytes not yet written to the FIFO (less than one 32-bit word)
+    uint8_t tail[4];
+    size_t tail_size = 0;
+
+    // Total number of bytes written since begin()
+    uint64_t total_size = 0;
+
+    void write_words(const uint8_t* ptr, size_t num_words);
     std::string read_hash();
     std::string convert_hash(std::string& hash);
 };
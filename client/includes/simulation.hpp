@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// Host simulation of the PL cores, enabled by building with -DAXI_SIMULATION.
+// AXIDriver then forwards register accesses to a software model of the device
+// at the driver's base address instead of mmap()ing /dev/mem, so the client,
+// apps and benchmarks run unmodified on a development machine.
+
+// A memory mapped device: reacts to 32-bit register reads and writes
+class SimDevice {
+public:
+    virtual ~SimDevice() {}
+    virtual uint32_t read(uint32_t offset) = 0;
+    virtual void write(uint32_t offset, uint32_t value) = 0;
+};
+
+// Whether every thread simulates its own board: its own devices, RSA core
+// scheduler (RSADriver::scheduler()) and SHA-3 core lock. Off by default, so
+// all threads share one board behind the same lock and scheduler as on the
+// hardware. tools/loadgen.cpp turns it on, before using any driver, to run many
+// devices from one process.
+extern bool sim_board_per_thread;
+
+// Returns the simulated device at the given base address. Devices are created
+// on first use and keep their state for the lifetime of the process (or of the
+// thread, with sim_board_per_thread), like the real cores. Unknown addresses
+// map to plain memory.
+SimDevice* sim_device(uint32_t base_address);
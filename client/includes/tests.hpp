@@ -2,6 +2,19 @@
 
 #include "rsadriver.hpp"
 #include "sha3driver.hpp"
+#include "aes.hpp"
+#include "bignum.hpp"
+#include "rsakeys.hpp"
+#include "rsascheduler.hpp"
+#include "csprng.hpp"
+#include "broker.hpp"
+#include "wire.hpp"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <mutex>
+#include <atomic>
 
 void rsadriver_test() {
     RSADriver rsa_driver;
@@ -36,6 +49,29 @@ void rsadriver_test() {
         std::cout << "Test #2 failed." << std::endl;
         std::cout << "Result: " << plaintext << std::endl;
     }
+
+    // Encryption to D_pub in software decrypts on the core
+    RSADriver::set_public_key(RSAKey::D_PUB, RSA_KEY_TABLE[RSAKey::D_PUB].modulus);
+    expected = "Hello, world!";
+    plaintext = rsa_driver.decrypt(rsa_driver.encrypt(expected, RSAKey::D_PUB));
+
+    if (plaintext.compare(expected) == 0)
+        std::cout << "Test #3 succeeded." << std::endl;
+    else {
+        std::cout << "Test #3 failed." << std::endl;
+        std::cout << "Result: " << plaintext << std::endl;
+    }
+
+    // A plaintext filling its chunks, whose last byte looks like length padding,
+    // ends with a chunk of padding only and decrypts unchanged
+    expected = std::string(2 * PKCS1_CHUNK_SIZE - 1, 'x') + '\x01';
+    const std::string ciphertext = rsa_driver.encrypt(expected, RSAKey::D_PUB);
+    plaintext = rsa_driver.decrypt(ciphertext);
+
+    if (ciphertext.size() == 3 * RSA_CHUNK_SIZE && plaintext.compare(expected) == 0)
+        std::cout << "Test #4 succeeded." << std::endl;
+    else
+        std::cout << "Test #4 failed." << std::endl;
 }
 
 void sha3driver_test() {
@@ -101,3 +137,335 @@ void sha3driver_test() {
         std::cout << "** Message length: " << message.size() << std::endl;
     }
 }
+
+void aes_test() {
+    std::cout << "Testing AES-128.." << std::endl;
+
+    // FIPS-197, Appendix C.1
+    const uint8_t key[16] = {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f};
+    const uint8_t plaintext[16] = {0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xaa,0xbb,0xcc,0xdd,0xee,0xff};
+    const uint8_t expected[16] = {0x69,0xc4,0xe0,0xd8,0x6a,0x7b,0x04,0x30,0xd8,0xcd,0xb7,0x80,0x70,0xb4,0xc5,0x5a};
+
+    AESCTR aes (key, plaintext);
+    uint8_t ciphertext[16];
+    aes.encrypt_block(plaintext, ciphertext);
+
+    if (std::memcmp(ciphertext, expected, 16) == 0)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed." << std::endl;
+
+    // CTR mode is its own inverse
+    std::string message = "Hello, world!";
+    AESCTR enc (key, plaintext), dec (key, plaintext);
+    enc.apply(reinterpret_cast<uint8_t *>(&message[0]), message.size());
+    dec.apply(reinterpret_cast<uint8_t *>(&message[0]), message.size());
+
+    if (message.compare("Hello, world!") == 0)
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+}
+
+void csprng_test() {
+    std::cout << "Testing ChaCha20 CSPRNG.." << std::endl;
+
+    // RFC 8439, section 2.3.2
+    uint8_t key[CHACHA_KEY_SIZE];
+    for (int i = 0; i < CHACHA_KEY_SIZE; i++)
+        key[i] = i;
+
+    const uint8_t nonce[CHACHA_NONCE_SIZE] = {0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00};
+    const uint8_t expected[CHACHA_BLOCK_SIZE] = {0x10,0xf1,0xe7,0xe4,0xd1,0x3b,0x59,0x15,0x50,0x0f,0xdd,0x1f,0xa3,0x20,0x71,0xc4,0xc7,0xd1,0xf4,0xc7,0x33,0xc0,0x68,0x03,0x04,0x22,0xaa,0x9a,0xc3,0xd4,0x6c,0x4e,0xd2,0x82,0x64,0x46,0x07,0x9f,0xaa,0x09,0x14,0xc2,0xd7,0x05,0xd9,0x8b,0x02,0xa2,0xb5,0x12,0x9c,0xd1,0xde,0x16,0x4e,0xb9,0xcb,0xd0,0x83,0xe8,0xa2,0x50,0x3c,0x4e};
+
+    uint8_t block[CHACHA_BLOCK_SIZE];
+    chacha20_block(key, 1, nonce, block);
+
+    if (std::memcmp(block, expected, CHACHA_BLOCK_SIZE) == 0)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed." << std::endl;
+
+    // Output spanning several refills never repeats a 64 byte block
+    std::vector<uint8_t> output (5 * sizeof(block) * CSPRNG_BUFFER_BLOCKS);
+    random_bytes(output.data(), output.size());
+
+    bool repeated = false;
+    for (size_t i = 0; i < output.size(); i += CHACHA_BLOCK_SIZE) {
+        for (size_t j = i + CHACHA_BLOCK_SIZE; j < output.size(); j += CHACHA_BLOCK_SIZE)
+            repeated |= std::memcmp(&output[i], &output[j], CHACHA_BLOCK_SIZE) == 0;
+    }
+
+    if (!repeated)
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+}
+
+void bignum_test() {
+    std::cout << "Testing software RSA arithmetic.." << std::endl;
+
+    const Montgomery mont (BigNum::from_hex(RSA_KEY_TABLE[RSAKey::D_PUB].modulus));
+    const BigNum e = BigNum::from_hex(RSA_KEY_TABLE[RSAKey::D_PUB].exponent);
+    const BigNum d = BigNum::from_hex(RSA_KEY_TABLE[RSAKey::D_PRV].exponent);
+
+    // 0x1234567890abcdef^e mod n, computed with Python's pow()
+    const BigNum message = BigNum::from_hex("1234567890abcdef");
+    const BigNum expected = BigNum::from_hex("77e79f9d1b4ee18a373818cd682e834cfa98a014360344d5f4e815f181fd6abc"
+                                             "bcc5555d133f41f18cf743757981e44359185c20e536bef395e88b1c12ca078b");
+
+    const BigNum ciphertext = mont.modexp(message, e);
+
+    if (ciphertext == expected)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed." << std::endl;
+
+    // Decrypting with the private exponent gives back the message
+    if (mont.modexp(ciphertext, d) == message)
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+
+    // Fixed public exponent path agrees with the generic one
+    if (mont.modexp_public(message) == expected)
+        std::cout << "Test #3 succeeded." << std::endl;
+    else
+        std::cout << "Test #3 failed." << std::endl;
+}
+
+void rsascheduler_test() {
+    std::cout << "Testing RSA core scheduling.." << std::endl;
+
+    RSAScheduler scheduler;
+    std::mutex order_lock;
+    std::vector<RSAPriority> order;
+
+    auto request = [&](RSAPriority priority) {
+        RSAScheduler::Grant grant (scheduler, priority);
+
+        std::lock_guard<std::mutex> guard (order_lock);
+        order.push_back(priority);
+    };
+
+    // Hold the core while a bulk request and then an interactive one queue up
+    scheduler.acquire(RSAPriority::BULK);
+
+    std::thread bulk (request, RSAPriority::BULK);
+    while (scheduler.queued(RSAPriority::BULK) == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    std::thread interactive (request, RSAPriority::INTERACTIVE);
+    while (scheduler.queued(RSAPriority::INTERACTIVE) == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    scheduler.release();
+    bulk.join();
+    interactive.join();
+
+    // The interactive request overtakes the bulk one that arrived first
+    if (order.size() == 2 && order[0] == RSAPriority::INTERACTIVE && order[1] == RSAPriority::BULK)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed." << std::endl;
+
+    // Both waited, and both queues were one deep
+    const SchedulerStats bulk_stats = scheduler.get_stats(RSAPriority::BULK);
+    const SchedulerStats interactive_stats = scheduler.get_stats(RSAPriority::INTERACTIVE);
+
+    if (bulk_stats.grants == 2 && bulk_stats.waits == 1 && bulk_stats.max_depth == 1 &&
+        interactive_stats.grants == 1 && interactive_stats.waits == 1 && interactive_stats.max_depth == 1)
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+}
+
+void concurrency_test() {
+    const int num_threads = 4;
+    const int rounds = 50;
+
+    std::cout << "Testing drivers from " << num_threads << " threads.." << std::endl;
+
+    const std::string message = "Hello, world!";
+    const std::string expected_hash = "9871c9900ce0b82977447481c9ca3f99ad40b6054ae9555771dcb865fc6e2c43b10097d5078c2f9868bb0e1f90a153810718d522cc24db34e437ad732dcefa37";
+
+    // Two RSA chunks to encrypt and two to decrypt per round
+    const std::string plaintext (PKCS1_CHUNK_SIZE + 20, 'x');
+
+    // Encryption runs on the core or, for keys with a modulus set, in software
+    const uint64_t rsa_chunks = RSADriver::counters.chunks + RSADriver::software_counters.chunks;
+    const uint64_t sha3_bytes = SHA3Driver::counters.bytes_in;
+
+    RSAScheduler& main_scheduler = RSADriver::scheduler();
+    std::mutex& main_lock = SHA3Driver::core_lock();
+
+    std::atomic<int> failures {0};
+    std::atomic<int> other_cores {0};
+    std::vector<std::thread> threads;
+
+    // Each thread hashes and decrypts with its own driver instances
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&]() {
+            SHA3Driver sha3driver;
+            RSADriver rsadriver;
+
+            // The drivers share one core, also in the simulation
+            if (&RSADriver::scheduler() != &main_scheduler || &SHA3Driver::core_lock() != &main_lock)
+                other_cores++;
+
+            for (int i = 0; i < rounds; i++) {
+                std::string data = message;
+
+                if (sha3driver.compute_hash(data, true).compare(expected_hash) != 0)
+                    failures++;
+
+                if (rsadriver.decrypt(rsadriver.encrypt(plaintext, RSAKey::D_PUB)).compare(plaintext) != 0)
+                    failures++;
+            }
+        });
+    }
+
+    for (std::thread& thread: threads)
+        thread.join();
+
+    if (failures == 0)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed (" << failures << " wrong results)." << std::endl;
+
+    // Shared counters don't lose increments
+    const uint64_t total = num_threads * rounds;
+
+    if (RSADriver::counters.chunks + RSADriver::software_counters.chunks - rsa_chunks == 4 * total &&
+        SHA3Driver::counters.bytes_in - sha3_bytes == INPUT_SIZE * total)
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+
+    if (other_cores == 0)
+        std::cout << "Test #3 succeeded." << std::endl;
+    else
+        std::cout << "Test #3 failed (" << other_cores << " threads on another core)." << std::endl;
+}
+
+void broker_test() {
+    const int num_clients = 3;
+
+    std::cout << "Testing crypto broker with " << num_clients << " clients.." << std::endl;
+
+    CryptoBroker broker ("/zynq-crypto-broker-test");
+
+    if (!broker.open()) {
+        std::cout << "Test #1 failed (no shared memory)." << std::endl;
+        return;
+    }
+
+    std::thread server ([&]() { broker.run(); });
+
+    const std::string expected_hash = "9871c9900ce0b82977447481c9ca3f99ad40b6054ae9555771dcb865fc6e2c43b10097d5078c2f9868bb0e1f90a153810718d522cc24db34e437ad732dcefa37";
+
+    // Spans several slot sized requests in both directions
+    const std::string plaintext (3 * BROKER_SLOT_DATA + 17, 'x');
+
+    std::atomic<int> failures {0};
+    std::atomic<int> rejected {0};
+    std::atomic<int> in_place {0};
+    std::vector<std::thread> clients;
+
+    for (int c = 0; c < num_clients; c++) {
+        clients.emplace_back([&]() {
+            BrokerConnection connection ("/zynq-crypto-broker-test");
+
+            if (!connection.connect()) {
+                failures++;
+                return;
+            }
+
+            BrokerSHA3Driver sha3driver (connection);
+            BrokerRSADriver rsadriver (connection);
+
+            std::string message = "Hello, world!";
+
+            if (sha3driver.compute_hash(message, true).compare(expected_hash) != 0)
+                failures++;
+
+            if (rsadriver.decrypt(rsadriver.encrypt(plaintext, RSAKey::D_PUB)).compare(plaintext) != 0)
+                failures++;
+
+            // The broker doesn't encrypt with the device private key
+            if (rsadriver.encrypt(message, RSAKey::D_PRV).empty())
+                rejected++;
+
+            // A request written straight into the slot isn't copied
+            message.copy(connection.data(), message.size());
+
+            sha3driver.begin();
+            sha3driver.update(connection.data(), message.size());
+
+            if (sha3driver.finalize(true).compare(expected_hash) == 0)
+                in_place++;
+        });
+    }
+
+    for (std::thread& client: clients)
+        client.join();
+
+    broker.stop();
+    server.join();
+
+    if (failures == 0)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed (" << failures << " wrong results)." << std::endl;
+
+    if (rejected == num_clients)
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+
+    if (in_place == num_clients)
+        std::cout << "Test #3 succeeded." << std::endl;
+    else
+        std::cout << "Test #3 failed." << std::endl;
+}
+
+#ifdef WIRE_CODEC
+void wire_test() {
+    std::cout << "Testing message codec.." << std::endl;
+
+    // Encoding produced by the generated protobuf code (Python)
+    const uint8_t expected[] = {0x08,0xef,0x9b,0xaf,0x85,0x89,0xcf,0x95,0x9a,0x12,0x10,0xac,0x02,0x18,0x07};
+
+    DeviceChallenge dc;
+    dc.set_ng(0x1234567890abcdef);
+    dc.set_nd(300);
+    dc.set_id(7);
+
+    uint8_t encoded[DeviceChallenge::MAX_SIZE];
+    const size_t size = dc.ByteSizeLong();
+
+    if (dc.SerializeToArray(encoded, sizeof(encoded)) && size == sizeof(expected) && std::memcmp(encoded, expected, size) == 0)
+        std::cout << "Test #1 succeeded." << std::endl;
+    else
+        std::cout << "Test #1 failed." << std::endl;
+
+    // M1 between unknown fixed32 and varint fields
+    const uint8_t m1_data[] = {0x4d,0x01,0x02,0x03,0x04, 0x08,0x05, 0x12,0x03,'a','b','c', 0x78,0x01};
+
+    M1 m1;
+    const bool valid = m1.ParseFromArray(m1_data, sizeof(m1_data));
+
+    if (valid && m1.v() == 5 && std::string(m1.oc().data(), m1.oc().size()) == "abc")
+        std::cout << "Test #2 succeeded." << std::endl;
+    else
+        std::cout << "Test #2 failed." << std::endl;
+
+    // Bytes field longer than the message
+    const uint8_t truncated[] = {0x12,0x05,'a','b','c'};
+
+    if (!m1.ParseFromArray(truncated, sizeof(truncated)))
+        std::cout << "Test #3 succeeded." << std::endl;
+    else
+        std::cout << "Test #3 failed." << std::endl;
+}
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+
+// Number of spans kept in the ring buffer (oldest spans are overwritten)
+#define TRACE_BUFFER_SIZE 4096
+
+struct TraceEvent {
+    const char* name;     // Span name (must be a string literal)
+    const char* category; // Optional category, e.g. org (may be NULL)
+    uint64_t start;       // Start time in microseconds since the tracer was created
+    uint64_t duration;    // Duration in microseconds
+    uint32_t tid;         // Small per-thread ID
+};
+
+// Lightweight tracer that records named spans into a preallocated ring buffer.
+// Recording is lock-free and allocation-free; disabled tracers record nothing.
+class Tracer {
+public:
+    static Tracer& instance();
+
+    void enable() { enabled = true; }
+    bool is_enabled() const { return enabled; }
+
+    // Microseconds since the tracer was created
+    uint64_t now() const;
+
+    // Records a completed span
+    void record(const char* name, const char* category, uint64_t start, uint64_t end);
+
+    // Writes all recorded spans as Chrome trace JSON (chrome://tracing, Perfetto)
+    bool dump(const char* path) const;
+private:
+    Tracer() : epoch(std::chrono::steady_clock::now()) {}
+
+    bool enabled = false;
+    std::chrono::steady_clock::time_point epoch;
+
+    TraceEvent events[TRACE_BUFFER_SIZE];
+    std::atomic<uint64_t> next {0};
+};
+
+// Records a span from construction until end() is called or the object goes out of scope
+class TraceSpan {
+public:
+    TraceSpan(const char* name, const char* category = NULL)
+        : name(name), category(category) {
+        Tracer& tracer = Tracer::instance();
+        start = tracer.is_enabled() ? tracer.now() : 0;
+    }
+
+    ~TraceSpan() {
+        this->end();
+    }
+
+    void end() {
+        Tracer& tracer = Tracer::instance();
+
+        if (!ended && tracer.is_enabled())
+            tracer.record(name, category, start, tracer.now());
+
+        ended = true;
+    }
+private:
+    const char* name;
+    const char* category;
+    uint64_t start;
+    bool ended = false;
+};
@@ -1,12 +1,7 @@
 #pragma once
 
 #include <cstdint>
-
-// Converts from a 32-bit int to a 4 byte array
-union {
-    uint32_t num;
-    uint8_t bytes[4];
-} IntSplitter;
+#include <string>
 
 inline uint32_t swap_bytes(const uint32_t& value) {
     // Swaps the the ordering of bytes in a 4 byte word
@@ -15,3 +10,11 @@ inline uint32_t swap_bytes(const uint32_t& value) {
            ((value & 0x00FF0000) >> 8)  |
            ((value & 0xFF000000) >> 24);
 }
+
+inline void append_word(std::string& out, uint32_t value) {
+    // Appends a 32-bit word to a byte string, most significant byte first
+    out.push_back((char)(value >> 24));
+    out.push_back((char)(value >> 16));
+    out.push_back((char)(value >> 8));
+    out.push_back((char)value);
+}
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+// Hand-written codec for the protocol messages (protocol/protocol.proto). The
+// encoding is the protobuf wire format, so either side can use the generated
+// code. Built with WIRE_CODEC (make CODEC=wire), the client uses these classes
+// instead of protocol.pb.h and doesn't link the protobuf runtime.
+//
+// Messages are fixed size and decode bytes fields as views into the parsed
+// buffer, so that buffer must outlive the message. Likewise, the set_ methods
+// of bytes fields keep a view of the caller's data rather than a copy.
+
+// Protobuf wire types
+#define WIRE_VARINT 0
+#define WIRE_FIXED64 1
+#define WIRE_LENGTH_DELIMITED 2
+#define WIRE_FIXED32 5
+
+// Encoded size of a 64 bit varint
+#define WIRE_MAX_VARINT_SIZE 10
+
+// View of a bytes field
+struct WireBytes {
+    const char* ptr = NULL;
+    size_t length = 0;
+
+    const char* data() const { return ptr; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+};
+
+// Reads the fields of an encoded message one at a time
+class WireReader {
+public:
+    WireReader(const void* data, size_t size)
+        : pos(static_cast<const uint8_t *>(data)), end(pos + size) {}
+
+    // Reads the next field header. Returns false at the end of the message or
+    // if the header is malformed (then done() is false as well)
+    bool next(uint32_t& field);
+
+    // Reads the value of the current field, which must have the matching wire type
+    bool read(uint64_t& value);
+    bool read(uint32_t& value);
+    bool read(bool& value);
+    bool read(WireBytes& value);
+
+    // Skips the value of the current field (unknown fields)
+    bool skip();
+
+    // Reads a varint outside a field, e.g., the length prefix of a delimited message
+    bool read_varint(uint64_t& value);
+
+    // Whether the whole message was read without errors
+    bool done() const { return !error && pos == end; }
+
+    // Bytes read so far
+    size_t position(const void* data) const { return pos - static_cast<const uint8_t *>(data); }
+private:
+    const uint8_t* pos;
+    const uint8_t* end;
+    uint32_t type = 0;
+    bool error = false;
+};
+
+// Writes fields into a buffer sized with the matching wire_size() calls. As in
+// proto3, fields with the default value (zero or empty) are left out.
+class WireWriter {
+public:
+    WireWriter(void* data) : pos(static_cast<uint8_t *>(data)) {}
+
+    void write(uint32_t field, uint64_t value);
+    void write(uint32_t field, const WireBytes& value);
+private:
+    uint8_t* pos;
+
+    void write_varint(uint64_t value);
+};
+
+// Encoded size of a field written by WireWriter
+size_t wire_size(uint32_t field, uint64_t value);
+size_t wire_size(uint32_t field, const WireBytes& value);
+
+// Fixed block allocator with the interface of google::protobuf::Arena that the
+// session uses. Allocations are served from the initial block and freed all at
+// once by Reset(); larger ones go to the heap until then. Only types without
+// destructors can be created in it.
+struct WireArenaOptions {
+    char* initial_block = NULL;
+    size_t initial_block_size = 0;
+};
+
+class WireArena {
+public:
+    explicit WireArena(const WireArenaOptions& options)
+        : block(options.initial_block), block_size(options.initial_block_size) {}
+
+    template <typename T, typename... Args>
+    static T* Create(WireArena* arena, Args&&... args) {
+        static_assert(std::is_trivially_destructible<T>::value, "WireArena doesn't run destructors");
+        return new (arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // Messages are plain objects (same name as google::protobuf::Arena)
+    template <typename T>
+    static T* CreateMessage(WireArena* arena) {
+        return Create<T>(arena);
+    }
+
+    template <typename T>
+    static T* CreateArray(WireArena* arena, size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "WireArena doesn't run destructors");
+        return static_cast<T *>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void Reset();
+private:
+    char* block;
+    size_t block_size;
+
+    // Bytes of the block in use
+    size_t used = 0;
+
+    // Allocations that didn't fit in the block
+    std::vector<std::unique_ptr<char[]>> overflow;
+
+    void* allocate(size_t size, size_t alignment);
+};
+
+#ifdef WIRE_CODEC
+
+// The messages have the accessors, setters and (de)serialization methods of
+// the generated classes that the client uses. Parsing follows proto3: fields
+// may come in any order, the last occurrence wins and unknown fields are skipped.
+
+class UpdateCheck {
+public:
+    // Largest encoded size (the installed image hash is a Keccak-512 hash)
+    static constexpr size_t MAX_SIZE = 2 * (1 + 5) + (1 + 1 + 64);
+
+    uint32_t v() const { return v_; }
+    uint32_t id() const { return id_; }
+    const WireBytes& hi() const { return hi_; }
+    void set_v(uint32_t value) { v_ = value; }
+    void set_id(uint32_t value) { id_ = value; }
+    void set_hi(const char* data, size_t size) { hi_.ptr = data; hi_.length = size; }
+    void set_hi(const std::string& value) { set_hi(value.data(), value.size()); }
+
+    void Clear() { *this = UpdateCheck(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    uint32_t v_ = 0;
+    uint32_t id_ = 0;
+    WireBytes hi_;
+};
+
+class UpdateStatus {
+public:
+    static constexpr size_t MAX_SIZE = 2 * (1 + 1);
+
+    bool successful() const { return successful_; }
+    bool parallel_auth() const { return parallel_auth_; }
+    void set_successful(bool value) { successful_ = value; }
+    void set_parallel_auth(bool value) { parallel_auth_ = value; }
+
+    void Clear() { *this = UpdateStatus(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    bool successful_ = false;
+    bool parallel_auth_ = false;
+};
+
+class OrgChallenge {
+public:
+    static constexpr size_t MAX_SIZE = (1 + WIRE_MAX_VARINT_SIZE) + (1 + 5);
+
+    uint64_t ng() const { return ng_; }
+    uint32_t ig() const { return ig_; }
+    void set_ng(uint64_t value) { ng_ = value; }
+    void set_ig(uint32_t value) { ig_ = value; }
+
+    void Clear() { *this = OrgChallenge(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    uint64_t ng_ = 0;
+    uint32_t ig_ = 0;
+};
+
+class DeviceChallenge {
+public:
+    static constexpr size_t MAX_SIZE = 2 * (1 + WIRE_MAX_VARINT_SIZE) + (1 + 5);
+
+    uint64_t ng() const { return ng_; }
+    uint64_t nd() const { return nd_; }
+    uint32_t id() const { return id_; }
+    void set_ng(uint64_t value) { ng_ = value; }
+    void set_nd(uint64_t value) { nd_ = value; }
+    void set_id(uint32_t value) { id_ = value; }
+
+    void Clear() { *this = DeviceChallenge(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    uint64_t ng_ = 0;
+    uint64_t nd_ = 0;
+    uint32_t id_ = 0;
+};
+
+class OrgResponse {
+public:
+    uint64_t nd() const { return nd_; }
+    uint32_t ig() const { return ig_; }
+    const WireBytes& hc() const { return hc_; }
+    void set_nd(uint64_t value) { nd_ = value; }
+    void set_ig(uint32_t value) { ig_ = value; }
+    void set_hc(const char* data, size_t size) { hc_.ptr = data; hc_.length = size; }
+    void set_hc(const std::string& value) { set_hc(value.data(), value.size()); }
+
+    void Clear() { *this = OrgResponse(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    uint64_t nd_ = 0;
+    uint32_t ig_ = 0;
+    WireBytes hc_;
+};
+
+class M1 {
+public:
+    uint32_t v() const { return v_; }
+    const WireBytes& oc() const { return oc_; }
+    void set_v(uint32_t value) { v_ = value; }
+    void set_oc(const char* data, size_t size) { oc_.ptr = data; oc_.length = size; }
+    void set_oc(const std::string& value) { set_oc(value.data(), value.size()); }
+
+    void Clear() { *this = M1(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    uint32_t v_ = 0;
+    WireBytes oc_;
+};
+
+class M2 {
+public:
+    const WireBytes& dc() const { return dc_; }
+    void set_dc(const char* data, size_t size) { dc_.ptr = data; dc_.length = size; }
+    void set_dc(const std::string& value) { set_dc(value.data(), value.size()); }
+
+    void Clear() { *this = M2(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    WireBytes dc_;
+};
+
+class M3 {
+public:
+    const WireBytes& or_() const { return or_bytes_; }
+    void set_or_(const char* data, size_t size) { or_bytes_.ptr = data; or_bytes_.length = size; }
+    void set_or_(const std::string& value) { set_or_(value.data(), value.size()); }
+
+    void Clear() { *this = M3(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    WireBytes or_bytes_;
+};
+
+class UpdateImage {
+public:
+    uint32_t size() const { return size_; }
+    const WireBytes& sk() const { return sk_; }
+    void set_size(uint32_t value) { size_ = value; }
+    void set_sk(const char* data, size_t size) { sk_.ptr = data; sk_.length = size; }
+    void set_sk(const std::string& value) { set_sk(value.data(), value.size()); }
+
+    void Clear() { *this = UpdateImage(); }
+    size_t ByteSizeLong() const;
+    bool ParseFromArray(const void* data, int size);
+    bool SerializeToArray(void* data, int size) const;
+
+    bool ParseFromString(const std::string& data) { return ParseFromArray(data.data(), data.size()); }
+    bool SerializeToString(std::string* output) const;
+private:
+    uint32_t size_ = 0;
+    WireBytes sk_;
+};
+
+#endif
@@ -0,0 +1,167 @@
+#include "aes.hpp"
+
+#include <cstring>
+
+// AES S-box (FIPS-197, Figure 7)
+static const uint8_t SBOX[256] = {
+    0x63,0x7c,0x77,0x7b,0xf2,0x6b,0x6f,0xc5,0x30,0x01,0x67,0x2b,0xfe,0xd7,0xab,0x76,
+    0xca,0x82,0xc9,0x7d,0xfa,0x59,0x47,0xf0,0xad,0xd4,0xa2,0xaf,0x9c,0xa4,0x72,0xc0,
+    0xb7,0xfd,0x93,0x26,0x36,0x3f,0xf7,0xcc,0x34,0xa5,0xe5,0xf1,0x71,0xd8,0x31,0x15,
+    0x04,0xc7,0x23,0xc3,0x18,0x96,0x05,0x9a,0x07,0x12,0x80,0xe2,0xeb,0x27,0xb2,0x75,
+    0x09,0x83,0x2c,0x1a,0x1b,0x6e,0x5a,0xa0,0x52,0x3b,0xd6,0xb3,0x29,0xe3,0x2f,0x84,
+    0x53,0xd1,0x00,0xed,0x20,0xfc,0xb1,0x5b,0x6a,0xcb,0xbe,0x39,0x4a,0x4c,0x58,0xcf,
+    0xd0,0xef,0xaa,0xfb,0x43,0x4d,0x33,0x85,0x45,0xf9,0x02,0x7f,0x50,0x3c,0x9f,0xa8,
+    0x51,0xa3,0x40,0x8f,0x92,0x9d,0x38,0xf5,0xbc,0xb6,0xda,0x21,0x10,0xff,0xf3,0xd2,
+    0xcd,0x0c,0x13,0xec,0x5f,0x97,0x44,0x17,0xc4,0xa7,0x7e,0x3d,0x64,0x5d,0x19,0x73,
+    0x60,0x81,0x4f,0xdc,0x22,0x2a,0x90,0x88,0x46,0xee,0xb8,0x14,0xde,0x5e,0x0b,0xdb,
+    0xe0,0x32,0x3a,0x0a,0x49,0x06,0x24,0x5c,0xc2,0xd3,0xac,0x62,0x91,0x95,0xe4,0x79,
+    0xe7,0xc8,0x37,0x6d,0x8d,0xd5,0x4e,0xa9,0x6c,0x56,0xf4,0xea,0x65,0x7a,0xae,0x08,
+    0xba,0x78,0x25,0x2e,0x1c,0xa6,0xb4,0xc6,0xe8,0xdd,0x74,0x1f,0x4b,0xbd,0x8b,0x8a,
+    0x70,0x3e,0xb5,0x66,0x48,0x03,0xf6,0x0e,0x61,0x35,0x57,0xb9,0x86,0xc1,0x1d,0x9e,
+    0xe1,0xf8,0x98,0x11,0x69,0xd9,0x8e,0x94,0x9b,0x1e,0x87,0xe9,0xce,0x55,0x28,0xdf,
+    0x8c,0xa1,0x89,0x0d,0xbf,0xe6,0x42,0x68,0x41,0x99,0x2d,0x0f,0xb0,0x54,0xbb,0x16
+};
+
+static const uint32_t RCON[10] = {
+    0x01000000, 0x02000000, 0x04000000, 0x08000000, 0x10000000,
+    0x20000000, 0x40000000, 0x80000000, 0x1b000000, 0x36000000
+};
+
+// Combined SubBytes + MixColumns lookup tables, built once on first use
+struct AESTables {
+    uint32_t te[4][256];
+
+    AESTables() {
+        for (int i = 0; i < 256; i++) {
+            const uint32_t s = SBOX[i];
+            const uint32_t s2 = ((s << 1) ^ ((s & 0x80) ? 0x1b : 0)) & 0xFF;
+            const uint32_t s3 = s2 ^ s;
+
+            te[0][i] = (s2 << 24) | (s << 16) | (s << 8) | s3;
+            te[1][i] = (te[0][i] >> 8) | (te[0][i] << 24);
+            te[2][i] = (te[0][i] >> 16) | (te[0][i] << 16);
+            te[3][i] = (te[0][i] >> 24) | (te[0][i] << 8);
+        }
+    }
+};
+
+static const AESTables& tables() {
+    static const AESTables t;
+    return t;
+}
+
+static inline uint32_t load_be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void store_be32(uint8_t* p, uint32_t v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static inline uint32_t sub_word(uint32_t w) {
+    return ((uint32_t)SBOX[w >> 24] << 24) | ((uint32_t)SBOX[(w >> 16) & 0xFF] << 16) |
+           ((uint32_t)SBOX[(w >> 8) & 0xFF] << 8) | SBOX[w & 0xFF];
+}
+
+AESCTR::AESCTR(const uint8_t* key, const uint8_t* nonce) {
+    this->expand_key(key);
+
+    // Counter block: nonce || 64-bit big endian block counter starting at 0
+    std::memcpy(counter, nonce, AES_NONCE_SIZE);
+    std::memset(counter + AES_NONCE_SIZE, 0, AES_BLOCK_SIZE - AES_NONCE_SIZE);
+}
+
+void AESCTR::expand_key(const uint8_t* key) {
+    for (int i = 0; i < 4; i++)
+        round_keys[i] = load_be32(key + 4 * i);
+
+    for (int i = 4; i < 4 * (AES_ROUNDS + 1); i++) {
+        uint32_t temp = round_keys[i - 1];
+
+        if (i % 4 == 0)
+            temp = sub_word((temp << 8) | (temp >> 24)) ^ RCON[i / 4 - 1];
+
+        round_keys[i] = round_keys[i - 4] ^ temp;
+    }
+}
+
+void AESCTR::encrypt_block(const uint8_t* in, uint8_t* out) const {
+    const AESTables& t = tables();
+    const uint32_t* rk = round_keys;
+
+    uint32_t s0 = load_be32(in)      ^ rk[0];
+    uint32_t s1 = load_be32(in + 4)  ^ rk[1];
+    uint32_t s2 = load_be32(in + 8)  ^ rk[2];
+    uint32_t s3 = load_be32(in + 12) ^ rk[3];
+
+    uint32_t t0, t1, t2, t3;
+
+    for (int round = 1; round < AES_ROUNDS; round++) {
+        rk += 4;
+
+        t0 = t.te[0][s0 >> 24] ^ t.te[1][(s1 >> 16) & 0xFF] ^ t.te[2][(s2 >> 8) & 0xFF] ^ t.te[3][s3 & 0xFF] ^ rk[0];
+        t1 = t.te[0][s1 >> 24] ^ t.te[1][(s2 >> 16) & 0xFF] ^ t.te[2][(s3 >> 8) & 0xFF] ^ t.te[3][s0 & 0xFF] ^ rk[1];
+        t2 = t.te[0][s2 >> 24] ^ t.te[1][(s3 >> 16) & 0xFF] ^ t.te[2][(s0 >> 8) & 0xFF] ^ t.te[3][s1 & 0xFF] ^ rk[2];
+        t3 = t.te[0][s3 >> 24] ^ t.te[1][(s0 >> 16) & 0xFF] ^ t.te[2][(s1 >> 8) & 0xFF] ^ t.te[3][s2 & 0xFF] ^ rk[3];
+
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    // Final round has no MixColumns
+    rk += 4;
+
+    t0 = ((uint32_t)SBOX[s0 >> 24] << 24) ^ ((uint32_t)SBOX[(s1 >> 16) & 0xFF] << 16) ^
+         ((uint32_t)SBOX[(s2 >> 8) & 0xFF] << 8) ^ SBOX[s3 & 0xFF] ^ rk[0];
+    t1 = ((uint32_t)SBOX[s1 >> 24] << 24) ^ ((uint32_t)SBOX[(s2 >> 16) & 0xFF] << 16) ^
+         ((uint32_t)SBOX[(s3 >> 8) & 0xFF] << 8) ^ SBOX[s0 & 0xFF] ^ rk[1];
+    t2 = ((uint32_t)SBOX[s2 >> 24] << 24) ^ ((uint32_t)SBOX[(s3 >> 16) & 0xFF] << 16) ^
+         ((uint32_t)SBOX[(s0 >> 8) & 0xFF] << 8) ^ SBOX[s1 & 0xFF] ^ rk[2];
+    t3 = ((uint32_t)SBOX[s3 >> 24] << 24) ^ ((uint32_t)SBOX[(s0 >> 16) & 0xFF] << 16) ^
+         ((uint32_t)SBOX[(s1 >> 8) & 0xFF] << 8) ^ SBOX[s2 & 0xFF] ^ rk[3];
+
+    store_be32(out, t0);
+    store_be32(out + 4, t1);
+    store_be32(out + 8, t2);
+    store_be32(out + 12, t3);
+}
+
+void AESCTR::next_keystream() {
+    this->encrypt_block(counter, keystream);
+    used = 0;
+
+    // Increment the big endian counter
+    for (int i = AES_BLOCK_SIZE - 1; i >= AES_NONCE_SIZE; i--) {
+        if (++counter[i] != 0)
+            break;
+    }
+}
+
+void AESCTR::apply(uint8_t* data, size_t length) {
+    size_t i = 0;
+
+    // Use up the key stream left over from the previous call
+    while (i < length && used < AES_BLOCK_SIZE)
+        data[i++] ^= keystream[used++];
+
+    // Whole blocks
+    while (length - i >= AES_BLOCK_SIZE) {
+        this->next_keystream();
+
+        for (int j = 0; j < AES_BLOCK_SIZE; j++)
+            data[i + j] ^= keystream[j];
+
+        i += AES_BLOCK_SIZE;
+        used = AES_BLOCK_SIZE;
+    }
+
+    // Partial block at the end
+    while (i < length) {
+        if (used == AES_BLOCK_SIZE)
+            this->next_keystream();
+
+        data[i++] ^= keystream[used++];
+    }
+}
@@ -1,37 +1,96 @@
-#include "axidriver.hpp"
-
-#ifdef __linux__
-    #include <cstdio>
-    #include <fcntl.h>
-
-    uint8_t* AXIDriver::get_mmap(uint32_t base_addr, size_t length) {
-        /**
-            Returns mmap() of some length at given base_addr as *ptr
-            Note: base_addr must be a multiple of PAGE_SIZE
-        */
-        int fd = open("/dev/mem", O_RDWR);
-        if (fd < 1) {
-            std::perror("/dev/mem "); // Prints formatted error
-            return NULL;
-        }
-        
-        // http://man7.org/linux/man-pages/man2/mmap.2.html
-        return static_cast<uint8_t *>(mmap(NULL, length, PROT_READ|PROT_WRITE, MAP_SHARED, fd, base_addr));
-    }
-#endif
-
-uint32_t AXIDriver::read(uint32_t offset) {
-    // Get pointer to correct offset
-    uint8_t* ptr = this->compute_offset(offset);
-
-    // Read 4 bytes into an int
-    uint32_t value;
-    std::memcpy(&value, ptr, 4);
-    
-    return value;
-}
-
-void AXIDriver::write(uint32_t offset, uint32_t value) {
-    uint8_t* ptr = this->compute_offset(offset);
-    std::memcpy(ptr, &value, 4);
-}
+#include "axidriver.hpp"
+
+#include <chrono>
+
+DriverStats AXIDriver::generic_stats ("AXI");
+
+#ifdef AXI_USE_MMAP
+    #include <cstdio>
+    #include <fcntl.h>
+
+    uint8_t* AXIDriver::get_mmap(uint32_t base_addr, size_t length) {
+        /**
+            Returns mmap() of some length at given base_addr as *ptr
+            Note: base_addr must be a multiple of PAGE_SIZE
+        */
+        int fd = open("/dev/mem", O_RDWR);
+        if (fd < 1) {
+            std::perror("/dev/mem "); // Prints formatted error
+            return NULL;
+        }
+        
+        // http://man7.org/linux/man-pages/man2/mmap.2.html
+        return static_cast<uint8_t *>(mmap(NULL, length, PROT_READ|PROT_WRITE, MAP_SHARED, fd, base_addr));
+    }
+#endif
+
+uint32_t AXIDriver::read(uint32_t offset) {
+    stats.reads++;
+
+    #ifdef AXI_SIMULATION
+        return device->read(offset);
+    #else
+        // Get pointer to correct offset
+        uint8_t* ptr = this->compute_offset(offset);
+
+        // Read 4 bytes into an int
+        uint32_t value;
+        std::memcpy(&value, ptr, 4);
+
+        return value;
+    #endif
+}
+
+void AXIDriver::write(uint32_t offset, uint32_t value) {
+    stats.writes++;
+
+    #ifdef AXI_SIMULATION
+        device->write(offset, value);
+    #else
+        uint8_t* ptr = this->compute_offset(offset);
+        std::memcpy(ptr, &value, 4);
+    #endif
+}
+
+void AXIDriver::wait_for(uint32_t offset, uint32_t value) {
+    /**
+     * Busy-waits until the (low byte of the) register at the given offset
+     * equals value. The spin count tells whether the core or the CPU is
+     * the bottleneck: few spins per completion means the core is idle
+     * waiting for the CPU.
+     */
+    const auto start = std::chrono::steady_clock::now();
+
+    uint64_t spins = 0;
+    while ((uint8_t)this->read(offset) != value)
+        spins++;
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    stats.completions++;
+    stats.poll_spins += spins;
+    stats.wait_time += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void DriverStats::reset() {
+    reads = 0;
+    writes = 0;
+    completions = 0;
+    poll_spins = 0;
+    wait_time = 0;
+    chunks = 0;
+    bytes_in = 0;
+    bytes_out = 0;
+}
+
+void DriverStats::print(std::ostream& out) const {
+    out << name << " driver: "
+        << reads << " reads, " << writes << " writes, "
+        << chunks << " chunks, " << bytes_in << " bytes in, " << bytes_out << " bytes out, "
+        << completions << " waits (" << poll_spins << " spins";
+
+    if (completions > 0)
+        out << ", " << poll_spins / completions << " per wait";
+
+    out << ", " << wait_time << " us)" << std::endl;
+}
@@ -0,0 +1,202 @@
+#include "bignum.hpp"
+
+#include <cstring>
+
+static inline uint32_t hex_value(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    return 0;
+}
+
+// Returns true if a >= b
+static bool greater_equal(const uint32_t* a, const uint32_t* b) {
+    for (int i = BIGNUM_LIMBS - 1; i >= 0; i--) {
+        if (a[i] != b[i])
+            return a[i] > b[i];
+    }
+
+    return true;
+}
+
+// a -= b, returns the borrow
+static uint32_t subtract(uint32_t* a, const uint32_t* b) {
+    uint64_t borrow = 0;
+
+    for (int i = 0; i < BIGNUM_LIMBS; i++) {
+        const uint64_t diff = (uint64_t)a[i] - b[i] - borrow;
+        a[i] = (uint32_t)diff;
+        borrow = (diff >> 32) & 1;
+    }
+
+    return (uint32_t)borrow;
+}
+
+BigNum BigNum::from_bytes(const uint8_t* bytes, size_t length) {
+    BigNum result;
+    std::memset(result.limbs, 0, sizeof(result.limbs));
+
+    // Last byte is the least significant one
+    for (size_t i = 0; i < length && i < BIGNUM_BYTES; i++) {
+        const uint8_t byte = bytes[length - 1 - i];
+        result.limbs[i / 4] |= (uint32_t)byte << (8 * (i % 4));
+    }
+
+    return result;
+}
+
+BigNum BigNum::from_hex(const char* hex) {
+    BigNum result;
+    std::memset(result.limbs, 0, sizeof(result.limbs));
+
+    const size_t length = std::strlen(hex);
+
+    // Last digit is the least significant one
+    for (size_t i = 0; i < length && i < BIGNUM_BYTES * 2; i++) {
+        const uint32_t digit = hex_value(hex[length - 1 - i]);
+        result.limbs[i / 8] |= digit << (4 * (i % 8));
+    }
+
+    return result;
+}
+
+void BigNum::to_bytes(uint8_t* out) const {
+    for (int i = 0; i < BIGNUM_BYTES; i++)
+        out[BIGNUM_BYTES - 1 - i] = (uint8_t)(limbs[i / 4] >> (8 * (i % 4)));
+}
+
+bool BigNum::operator==(const BigNum& other) const {
+    return std::memcmp(limbs, other.limbs, sizeof(limbs)) == 0;
+}
+
+Montgomery::Montgomery(const BigNum& modulus) : n(modulus) {
+    /**
+     * Precomputes -n^-1 mod 2^32 and R^2 mod n for the given odd modulus.
+     */
+    // Newton iteration for n[0]^-1 mod 2^32 (each step doubles the correct bits)
+    uint32_t inverse = n.limbs[0];
+    for (int i = 0; i < 5; i++)
+        inverse *= 2 - n.limbs[0] * inverse;
+
+    n0inv = (uint32_t)0 - inverse;
+
+    // R^2 mod n by doubling 1 a total of 2 * 512 times
+    std::memset(r2.limbs, 0, sizeof(r2.limbs));
+    r2.limbs[0] = 1;
+
+    for (int i = 0; i < 2 * BIGNUM_LIMBS * 32; i++) {
+        const uint32_t carry = r2.limbs[BIGNUM_LIMBS - 1] >> 31;
+
+        for (int j = BIGNUM_LIMBS - 1; j > 0; j--)
+            r2.limbs[j] = (r2.limbs[j] << 1) | (r2.limbs[j - 1] >> 31);
+        r2.limbs[0] <<= 1;
+
+        if (carry || greater_equal(r2.limbs, n.limbs))
+            subtract(r2.limbs, n.limbs);
+    }
+}
+
+void Montgomery::multiply(const BigNum& a, const BigNum& b, BigNum& out) const {
+    /**
+     * Coarsely integrated operand scanning (CIOS) Montgomery multiplication.
+     * Inputs must be less than n; the result is fully reduced.
+     */
+    uint32_t t[BIGNUM_LIMBS + 2] = {0};
+
+    for (int i = 0; i < BIGNUM_LIMBS; i++) {
+        // t += a * b[i]
+        uint64_t carry = 0;
+        for (int j = 0; j < BIGNUM_LIMBS; j++) {
+            const uint64_t sum = (uint64_t)a.limbs[j] * b.limbs[i] + t[j] + carry;
+            t[j] = (uint32_t)sum;
+            carry = sum >> 32;
+        }
+
+        uint64_t sum = (uint64_t)t[BIGNUM_LIMBS] + carry;
+        t[BIGNUM_LIMBS] = (uint32_t)sum;
+        t[BIGNUM_LIMBS + 1] = (uint32_t)(sum >> 32);
+
+        // t = (t + m * n) / 2^32, with m chosen so that the low limb cancels
+        const uint32_t m = t[0] * n0inv;
+
+        carry = ((uint64_t)m * n.limbs[0] + t[0]) >> 32;
+        for (int j = 1; j < BIGNUM_LIMBS; j++) {
+            sum = (uint64_t)m * n.limbs[j] + t[j] + carry;
+            t[j - 1] = (uint32_t)sum;
+            carry = sum >> 32;
+        }
+
+        sum = (uint64_t)t[BIGNUM_LIMBS] + carry;
+        t[BIGNUM_LIMBS - 1] = (uint32_t)sum;
+        t[BIGNUM_LIMBS] = t[BIGNUM_LIMBS + 1] + (uint32_t)(sum >> 32);
+    }
+
+    // Result is less than 2n: subtract n once if needed
+    if (t[BIGNUM_LIMBS] != 0 || greater_equal(t, n.limbs))
+        subtract(t, n.limbs);
+
+    std::memcpy(out.limbs, t, sizeof(out.limbs));
+}
+
+BigNum Montgomery::modexp(const BigNum& base, const BigNum& exponent) const {
+    /**
+     * Left-to-right binary exponentiation in the Montgomery domain.
+     */
+    BigNum one;
+    std::memset(one.limbs, 0, sizeof(one.limbs));
+    one.limbs[0] = 1;
+
+    // Reduce the base first in case it is not less than n
+    BigNum reduced = base;
+    while (greater_equal(reduced.limbs, n.limbs))
+        subtract(reduced.limbs, n.limbs);
+
+    // Convert to Montgomery form: x * R mod n
+    BigNum x, result;
+    this->multiply(reduced, r2, x);
+    this->multiply(one, r2, result);
+
+    // Find the most significant set bit of the exponent
+    int top = BIGNUM_LIMBS * 32 - 1;
+    while (top >= 0 && !((exponent.limbs[top / 32] >> (top % 32)) & 1))
+        top--;
+
+    for (int i = top; i >= 0; i--) {
+        this->multiply(result, result, result);
+
+        if ((exponent.limbs[i / 32] >> (i % 32)) & 1)
+            this->multiply(result, x, result);
+    }
+
+    // Convert back from Montgomery form
+    this->multiply(result, one, result);
+
+    return result;
+}
+
+BigNum Montgomery::modexp_public(const BigNum& base) const {
+    /**
+     * Fixed exponentiation by 2^16 + 1. Squaring the Montgomery form of the
+     * base 16 times gives base^(2^16) * R; multiplying that by the plain base
+     * drops the factor R again, so no conversion back is needed.
+     */
+    static_assert(RSA_PUBLIC_EXPONENT == (1 << 16) + 1, "modexp_public() assumes F4");
+
+    BigNum reduced = base;
+    while (greater_equal(reduced.limbs, n.limbs))
+        subtract(reduced.limbs, n.limbs);
+
+    BigNum result;
+    this->multiply(reduced, r2, result);
+
+    for (int i = 0; i < 16; i++)
+        this->multiply(result, result, result);
+
+    this->multiply(result, reduced, result);
+
+    return result;
+}
@@ -0,0 +1,510 @@
+#include "broker.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// Largest plaintext per encryption request whose ciphertext fits in a slot
+#define BROKER_PLAINTEXT_DATA ((BROKER_SLOT_DATA / RSA_CHUNK_SIZE) * PKCS1_CHUNK_SIZE)
+
+// Same for the last part of a message, which may need a chunk of length padding
+#define BROKER_FINAL_PLAINTEXT_DATA (BROKER_PLAINTEXT_DATA - PKCS1_CHUNK_SIZE)
+
+static void lock_region(BrokerRegion* region) {
+    /**
+     * Locks the region. If a process died while holding the lock, the slot
+     * fields are still consistent (they are only changed as a whole under the
+     * lock), so the lock is simply marked usable again.
+     */
+    if (pthread_mutex_lock(&region->lock) == EOWNERDEAD)
+        pthread_mutex_consistent(&region->lock);
+}
+
+static int wait_region(pthread_cond_t* cond, BrokerRegion* region) {
+    /**
+     * Waits on cond for at most BROKER_POLL_INTERVAL, returning ETIMEDOUT if
+     * nothing happened in the meantime.
+     */
+    timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    deadline.tv_sec += BROKER_POLL_INTERVAL / 1000;
+    deadline.tv_nsec += (BROKER_POLL_INTERVAL % 1000) * 1000000L;
+
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    const int result = pthread_cond_timedwait(cond, &region->lock, &deadline);
+
+    if (result == EOWNERDEAD)
+        pthread_mutex_consistent(&region->lock);
+
+    return result;
+}
+
+static bool process_exists(pid_t pid) {
+    return kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+CryptoBroker::~CryptoBroker() {
+    if (region != NULL) {
+        munmap(region, sizeof(BrokerRegion));
+        shm_unlink(name);
+    }
+}
+
+bool CryptoBroker::open() {
+    /**
+     * Creates and initializes the shared memory region. A region left behind
+     * by a previous broker is removed first; its clients get an error on
+     * their next request and have to reconnect.
+     */
+    shm_unlink(name);
+
+    const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0660);
+
+    if (fd < 0) {
+        std::perror("shm_open");
+        return false;
+    }
+
+    if (ftruncate(fd, sizeof(BrokerRegion)) != 0) {
+        std::perror("ftruncate");
+        close(fd);
+        return false;
+    }
+
+    void* memory = mmap(NULL, sizeof(BrokerRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        std::perror("mmap");
+        return false;
+    }
+
+    region = static_cast<BrokerRegion *>(memory);
+    std::memset(region, 0, sizeof(BrokerRegion));
+
+    // Robust, so a client that dies holding the lock doesn't block everyone
+    pthread_mutexattr_t mutex_attr;
+    pthread_mutexattr_init(&mutex_attr);
+    pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&mutex_attr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&region->lock, &mutex_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+    pthread_cond_init(&region->work, &cond_attr);
+
+    for (int i = 0; i < BROKER_SLOTS; i++)
+        pthread_cond_init(&region->slots[i].done, &cond_attr);
+
+    pthread_condattr_destroy(&cond_attr);
+
+    region->broker = getpid();
+    region->version = BROKER_VERSION;
+
+    // Clients check the magic last, after everything else is set up
+    __sync_synchronize();
+    region->magic = BROKER_MAGIC;
+
+    return true;
+}
+
+void CryptoBroker::stop() {
+    // Safe to call from a signal handler: run() returns within BROKER_POLL_INTERVAL
+    running = false;
+}
+
+void CryptoBroker::run() {
+    /**
+     * Serves pending requests one at a time, in round robin order over the
+     * slots. Requests are processed outside the lock, so clients can queue
+     * their next request in the meantime.
+     */
+    if (region == NULL)
+        return;
+
+    lock_region(region);
+
+    while (running) {
+        const int index = this->next_request();
+
+        if (index < 0) {
+            if (wait_region(&region->work, region) == ETIMEDOUT)
+                this->reap_clients();
+
+            continue;
+        }
+
+        BrokerSlot& slot = region->slots[index];
+        slot.state = SLOT_BUSY;
+        last_served = index;
+
+        pthread_mutex_unlock(&region->lock);
+        this->process(slot);
+        lock_region(region);
+
+        slot.state = SLOT_DONE;
+        pthread_cond_signal(&slot.done);
+    }
+
+    pthread_mutex_unlock(&region->lock);
+}
+
+int CryptoBroker::next_request() {
+    /**
+     * Returns the first pending slot after the one served last, preferring
+     * interactive requests (as RSADriver::scheduler() does for threads), so
+     * protocol messages overtake image decryption at the next request. The
+     * SHA-3 core holds the state of one hash at a time, so hash requests of
+     * other clients are skipped until the current hash is finalized.
+     */
+    // The client hashing on the core is gone
+    if (hash_owner >= 0) {
+        const BrokerSlot& owner = region->slots[hash_owner];
+
+        if (owner.state == SLOT_FREE || owner.claim != hash_claim)
+            hash_owner = -1;
+    }
+
+    const int index = this->next_request(true);
+
+    return (index >= 0) ? index : this->next_request(false);
+}
+
+int CryptoBroker::next_request(bool interactive_only) {
+    for (int i = 1; i <= BROKER_SLOTS; i++) {
+        const int index = (last_served + i) % BROKER_SLOTS;
+        const BrokerSlot& slot = region->slots[index];
+
+        if (slot.state != SLOT_PENDING)
+            continue;
+
+        if (interactive_only && slot.priority != RSAPriority::INTERACTIVE)
+            continue;
+
+        const bool is_hash = slot.op == HASH_BEGIN || slot.op == HASH_UPDATE || slot.op == HASH_FINALIZE;
+
+        if (is_hash && hash_owner >= 0 && !(hash_owner == index && hash_claim == slot.claim))
+            continue;
+
+        return index;
+    }
+
+    return -1;
+}
+
+void CryptoBroker::reap_clients() {
+    for (int i = 0; i < BROKER_SLOTS; i++) {
+        BrokerSlot& slot = region->slots[i];
+
+        if (slot.state != SLOT_FREE && slot.state != SLOT_BUSY && !process_exists(slot.owner))
+            slot.state = SLOT_FREE;
+    }
+}
+
+void CryptoBroker::process(BrokerSlot& slot) {
+    /**
+     * Runs a request on the cores. The input is read from and the result
+     * written to the slot's payload buffer.
+     */
+    const int index = &slot - region->slots;
+    const char* data = reinterpret_cast<const char *>(slot.data);
+    const bool is_hash_owner = (hash_owner == index && hash_claim == slot.claim);
+
+    result.clear();
+    bool success = true;
+
+    switch (slot.op) {
+        case HASH_BEGIN:
+            hash_owner = index;
+            hash_claim = slot.claim;
+            sha3.begin();
+            break;
+
+        case HASH_UPDATE:
+            if (is_hash_owner)
+                sha3.update(data, slot.length);
+            else
+                success = false;
+            break;
+
+        case HASH_FINALIZE:
+            if (is_hash_owner) {
+                result = sha3.finalize(slot.arg != 0);
+                hash_owner = -1;
+            } else
+                success = false;
+            break;
+
+        case RSA_ENCRYPT:
+        case RSA_ENCRYPT_PART: {
+            const bool is_final = (slot.op == RSA_ENCRYPT);
+
+            // Never encrypt (i.e., sign) with the device private key for other processes
+            if (slot.arg == RSAKey::D_PRV || slot.length > (is_final ? BROKER_FINAL_PLAINTEXT_DATA : BROKER_PLAINTEXT_DATA))
+                success = false;
+            else if (!is_final && slot.length % PKCS1_CHUNK_SIZE != 0)
+                success = false;
+            else
+                rsa.encrypt(std::string(data, slot.length), static_cast<RSAKey>(slot.arg), result, is_final);
+            break;
+        }
+
+        case RSA_DECRYPT:
+            if (slot.length % RSA_CHUNK_SIZE != 0)
+                success = false;
+            else
+                rsa.decrypt(data, slot.length, result, slot.arg != 0);
+            break;
+
+        default:
+            success = false;
+    }
+
+    std::memcpy(slot.data, result.data(), result.size());
+    slot.length = result.size();
+    slot.status = success ? 1 : 0;
+}
+
+BrokerConnection::~BrokerConnection() {
+    this->disconnect();
+}
+
+bool BrokerConnection::connect() {
+    /**
+     * Maps the broker's region and claims a free slot.
+     *
+     * Returns: false if the broker isn't running or all slots are taken
+     */
+    const int fd = shm_open(name, O_RDWR, 0);
+
+    if (fd < 0) {
+        std::cout << "Crypto broker is not running" << std::endl;
+        return false;
+    }
+
+    void* memory = mmap(NULL, sizeof(BrokerRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (memory == MAP_FAILED) {
+        std::perror("mmap");
+        return false;
+    }
+
+    region = static_cast<BrokerRegion *>(memory);
+
+    if (region->magic != BROKER_MAGIC || region->version != BROKER_VERSION) {
+        std::cout << "Crypto broker region has an unknown layout" << std::endl;
+        munmap(region, sizeof(BrokerRegion));
+        region = NULL;
+        return false;
+    }
+
+    lock_region(region);
+
+    for (int i = 0; i < BROKER_SLOTS && slot == NULL; i++) {
+        if (region->slots[i].state == SLOT_FREE) {
+            slot = &region->slots[i];
+            slot->state = SLOT_IDLE;
+            slot->claim++;
+            slot->owner = getpid();
+        }
+    }
+
+    pthread_mutex_unlock(&region->lock);
+
+    if (slot == NULL) {
+        std::cout << "No free crypto broker slot" << std::endl;
+        this->disconnect();
+        return false;
+    }
+
+    return true;
+}
+
+void BrokerConnection::disconnect() {
+    if (region == NULL)
+        return;
+
+    if (slot != NULL) {
+        lock_region(region);
+        slot->state = SLOT_FREE;
+        pthread_mutex_unlock(&region->lock);
+
+        slot = NULL;
+    }
+
+    munmap(region, sizeof(BrokerRegion));
+    region = NULL;
+}
+
+BrokerConnection& BrokerConnection::thread_connection() {
+    thread_local BrokerConnection connection;
+
+    if (!connection.connected())
+        connection.connect();
+
+    return connection;
+}
+
+bool BrokerConnection::call(BrokerOp op, uint32_t arg, const char* input, size_t length, size_t& result_length,
+                            RSAPriority priority) {
+    /**
+     * The slot is idle, so its payload buffer is ours until the request is
+     * pending: callers that build the request in data() save the copy, and
+     * read the result from there as well.
+     */
+    result_length = 0;
+
+    if (slot == NULL || length > BROKER_SLOT_DATA)
+        return false;
+
+    if (length > 0 && input != this->data())
+        std::memmove(slot->data, input, length);
+
+    lock_region(region);
+
+    slot->op = op;
+    slot->arg = arg;
+    slot->priority = priority;
+    slot->length = length;
+    slot->state = SLOT_PENDING;
+
+    pthread_cond_signal(&region->work);
+
+    while (slot->state != SLOT_DONE) {
+        if (wait_region(&slot->done, region) == ETIMEDOUT && !process_exists(region->broker)) {
+            slot->state = SLOT_IDLE;
+            pthread_mutex_unlock(&region->lock);
+
+            // A restarted broker has a new region (see thread_connection())
+            std::cout << "Crypto broker exited" << std::endl;
+            this->disconnect();
+            return false;
+        }
+    }
+
+    slot->state = SLOT_IDLE;
+
+    const bool success = slot->status != 0;
+    result_length = slot->length;
+
+    pthread_mutex_unlock(&region->lock);
+
+    return success;
+}
+
+std::string BrokerRSADriver::decrypt(const std::string& ciphertext, bool is_final) {
+    std::string plaintext;
+    this->decrypt(ciphertext.data(), ciphertext.size(), plaintext, is_final);
+    return plaintext;
+}
+
+void BrokerRSADriver::decrypt(const std::string& ciphertext, std::string& plaintext, bool is_final) {
+    this->decrypt(ciphertext.data(), ciphertext.size(), plaintext, is_final);
+}
+
+void BrokerRSADriver::decrypt(const char* ciphertext, size_t size, std::string& plaintext, bool is_final) {
+    /**
+     * Decrypts with the device key on the broker, in parts of up to one slot.
+     * Each part's plaintext is appended straight from the slot.
+     */
+    plaintext.clear();
+    size_t result_length;
+
+    for (size_t offset = 0; offset < size; offset += BROKER_SLOT_DATA) {
+        const size_t length = std::min<size_t>(BROKER_SLOT_DATA, size - offset);
+        const bool last = (offset + length == size);
+
+        if (!connection.call(RSA_DECRYPT, is_final && last, ciphertext + offset, length, result_length, priority)) {
+            plaintext.clear();
+            return;
+        }
+
+        plaintext.append(connection.data(), result_length);
+    }
+}
+
+std::string BrokerRSADriver::encrypt(const std::string& plaintext, RSAKey key) {
+    std::string ciphertext;
+    this->encrypt(plaintext, key, ciphertext);
+    return ciphertext;
+}
+
+void BrokerRSADriver::encrypt(const std::string& plaintext, RSAKey key, std::string& ciphertext) {
+    /**
+     * Encrypts to the given public key on the broker, in parts of whole
+     * PKCS#1 chunks, so only the last part ends with a partial chunk and
+     * carries the length padding.
+     */
+    ciphertext.clear();
+    size_t offset = 0, result_length;
+
+    while (plaintext.size() - offset > BROKER_FINAL_PLAINTEXT_DATA) {
+        const size_t whole_chunks = (plaintext.size() - offset) / PKCS1_CHUNK_SIZE * PKCS1_CHUNK_SIZE;
+        const size_t length = std::min<size_t>(BROKER_PLAINTEXT_DATA, whole_chunks);
+
+        if (!connection.call(RSA_ENCRYPT_PART, key, plaintext.data() + offset, length, result_length, priority)) {
+            ciphertext.clear();
+            return;
+        }
+
+        ciphertext.append(connection.data(), result_length);
+        offset += length;
+    }
+
+    if (!connection.call(RSA_ENCRYPT, key, plaintext.data() + offset, plaintext.size() - offset, result_length, priority)) {
+        ciphertext.clear();
+        return;
+    }
+
+    ciphertext.append(connection.data(), result_length);
+}
+
+std::string BrokerSHA3Driver::compute_hash(std::string& data, bool readable) {
+    this->begin();
+    this->update(data.data(), data.size());
+    return this->finalize(readable);
+}
+
+void BrokerSHA3Driver::begin() {
+    size_t unused;
+    connection.call(HASH_BEGIN, 0, NULL, 0, unused);
+}
+
+void BrokerSHA3Driver::update(const char* data, size_t length) {
+    size_t unused;
+
+    for (size_t offset = 0; offset < length; offset += BROKER_SLOT_DATA) {
+        const size_t part = std::min<size_t>(BROKER_SLOT_DATA, length - offset);
+
+        if (!connection.call(HASH_UPDATE, 0, data + offset, part, unused))
+            return;
+    }
+}
+
+std::string BrokerSHA3Driver::finalize(bool readable) {
+    /**
+     * Returns: the hash, or an empty string if the hash failed
+     */
+    size_t hash_length;
+
+    if (!connection.call(HASH_FINALIZE, readable, NULL, 0, hash_length))
+        return "";
+
+    return std::string(connection.data(), hash_length);
+}
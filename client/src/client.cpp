@@ -3,341 +3,243 @@
 #include <fstream>
 #include <sstream>
 #include <chrono>
-#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <algorithm>
+#include <thread>
 
-#define ASIO_STANDALONE // Do not use Boost
-#include "asio.hpp"
+#include <sys/resource.h>
 
-#include "protocol.pb.h" // protobuf message headers
+#include "session.hpp" // for UpdateSession and asio
+#include "config.hpp"
 
 #include "sha3driver.hpp"
 #include "rsadriver.hpp"
+#include "image.hpp"
+#include "delta.hpp"
+#include "lz4.hpp"
+#include "aes.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
+#include "csprng.hpp"
+#include "policy.hpp"
+#include "notify.hpp"
 
 using asio::ip::tcp;
 
-// Protocol params
-const uint32_t NUM_ORGS = 2;
+// Protocol params (defaults for settings missing from the config file, see config.hpp)
+const uint32_t NUM_CONFIRMING_ORGS = 1;
 const uint32_t VERSION = 1;
 const uint32_t ID = 34567154;
+const char* CONFIG_PATH = "updater.conf";
 const char* IMAGE_PATH = "image.bin";
 const char* DECRYPTED_IMAGE_PATH = "decrypted_image.bin";
+const char* DECOMPRESSED_IMAGE_PATH = "decompressed_image.bin";
+const char* PATCHED_IMAGE_PATH = "patched_image.bin";
+const char* CURRENT_IMAGE_PATH = "current_image.bin"; // Installed image, base for delta updates
+const char* CURRENT_VERSION_PATH = "current_image.version"; // Version of the installed image
+const char* CURRENT_VERSION_TEMP_PATH = "current_image.version.tmp";
 
-#define DEBUG // Print debug messages
-#define ENCRYPT // If defined, protocol is encrypted
+// Benchmark mode: encrypted synthetic image served over loopback, extracted fields
+const char* BENCH_SOURCE_PATH = "bench_source.bin";
+const char* BENCH_FIELD_PREFIX = "bench_field_";
 
-enum Org {
-    GU,
-    GC
-};
+// Daemon mode: checks for updates every DAEMON_POLL_INTERVAL (jittered down to
+// half of it) and, after a random delay of up to ANNOUNCE_JITTER, when the server
+// announces a release (seconds)
+const uint32_t DAEMON_POLL_INTERVAL = 21600;
+const uint32_t ANNOUNCE_JITTER = 30;
 
-void set_random_seed() {
-    /**
-     * Gets a random 32-bit seed value from /dev/urandom on Linux and then
-     * sets it globally.
-     */
-    std::ifstream random ("/dev/urandom", std::ios::binary | std::ios::in);
-    uint32_t seed;
-    random.read(reinterpret_cast<char *>(&seed), sizeof seed);
-    random.close();
-    std::srand(seed);
-}
-
-void print_binary_string(std::string& str) {
-    for (int i = 0; i < str.size(); i++)
-        std::cout << (int)str.at(i) << " ";
-
-    std::cout << std::endl;
-}
+// Images are decrypted in blocks of this size (must be a multiple of RSA_CHUNK_SIZE)
+const uint32_t DECRYPT_BLOCK_SIZE = 1048576;
 
 void close_socket(tcp::socket& socket) {
     if (socket.is_open())
         socket.close();
 }
 
-struct ImageHeader {
-    // Field sizes
-    uint32_t s1, s2, s3;
+ImageHeader image_header;
 
-    // SHA3 hash
-    std::string hash;
-} image_header;
+// Session key (key || nonce) for images encrypted in hybrid mode, empty otherwise
+std::string session_key;
 
-void send_update_check(tcp::socket& socket) {
-    /**
-     * Send update check to server and return new update version.
-     */
-    std::string data;
-    
-    UpdateCheck uc;
-    uc.set_v(VERSION);
-    uc.set_id(ID);
-    uc.SerializeToString(&data);
-    
-    socket.send(asio::buffer(data));
+std::streampos get_file_size(const char* path) {
+    std::streampos fsize = 0;
+    std::ifstream file(path, std::ios::binary);
+
+    fsize = file.tellg();
+    file.seekg(0, std::ios::end);
+    fsize = file.tellg() - fsize;
+    file.close();
+
+    return fsize;
 }
 
-void receive_image(tcp::socket& socket, uint32_t image_size) {
-    // Open output file for received image
-    std::ofstream out_file (IMAGE_PATH, std::ios::binary | std::ios::out);
+template <typename SHA3>
+bool decrypt_image_aes(ImageCheck<SHA3>& check) {
+    /**
+     * Decrypts an image encrypted in hybrid mode using the AES-CTR session key.
+     * The image is streamed through a fixed size buffer.
+     */
+    std::ifstream image (IMAGE_PATH, std::ios::binary | std::ios::in);
+    std::ofstream decrypted_image (DECRYPTED_IMAGE_PATH, std::ios::binary | std::ios::out);
 
-    // Allocate buffer of 4 KB
-    std::vector<uint8_t> buf (4096);
+    const uint8_t* key = reinterpret_cast<const uint8_t *>(session_key.data());
+    AESCTR aes (key, key + AES_KEY_SIZE);
 
-    // Bytes read from socket
-    size_t len;
+    std::vector<uint8_t> buf (DECRYPT_BLOCK_SIZE);
+    char* ptr = reinterpret_cast<char *>(buf.data());
 
-    // Total bytes read
-    uint32_t total_read = 0;
+    while (image.read(ptr, buf.size()) || image.gcount() > 0) {
+        TraceSpan span ("Decrypt block");
+        aes.apply(buf.data(), image.gcount());
 
-    // Keep reading while data available
-    while (total_read < image_size) {
-        len = socket.receive(asio::buffer(buf));
-        out_file.write(reinterpret_cast<char *>(buf.data()), len);
+        if (!check.update(ptr, image.gcount()))
+            return false;
 
-        total_read += len;
+        decrypted_image.write(ptr, image.gcount());
     }
 
-    // Done!
-    socket.send(asio::buffer("OK"));
+    decrypted_image.close();
 
-    out_file.close();
+    return true;
 }
 
-bool run_protocol(tcp::socket& socket, Org org, std::string& hash) {
-    bool valid;
-    
-    // Sets a global random seed from /dev/urandom
-    set_random_seed();
-    
-    // Receive buffers
-    std::string data;
-    data.reserve(512);
-
-    size_t len;
-    std::vector<uint8_t> buf (512);
-
-    // Store incoming M1 in 512 byte receive buffer
-    len = socket.receive(asio::buffer(buf));
-    data = std::string(buf.begin(), buf.begin() + len);
-    
-    // Parse M1 using protobuf
-    M1 m1;
-    valid = m1.ParseFromString(data);
+template <typename Encryption, typename SHA3>
+bool decrypt_image(ImageCheck<SHA3>& check) {
+    /**
+     * Decrypts the update image, passing the plaintext through check. Stops as
+     * soon as check rejects the image, e.g., right after the first block if
+     * the header hash isn't the confirmed one.
+     */
+    if (Encryption::enabled && !session_key.empty())
+        return decrypt_image_aes(check);
 
-    if (!valid) {
-        print_binary_string(data);
-        std::cout << "Error parsing M1 from: " << org << std::endl;
-        return false;
-    }
+    auto image_size = get_file_size(IMAGE_PATH);
 
-    #ifdef ENCRYPT
-        RSADriver rsadriver;
-        data = rsadriver.decrypt(m1.oc());
-    #else
-        data = m1.oc();
-    #endif
-
-    // Parse OrgChallenge embedded in M1
-    OrgChallenge oc;
-    valid = oc.ParseFromString(data);
-    if (!valid) {
-        print_binary_string(data);
-        std::cout << std::endl << "Error parsing OrgChallenge from: " << org << std::endl;
-        return false;
-    }
+    std::ifstream image (IMAGE_PATH, std::ios::binary | std::ios::in);
+    std::ofstream decrypted_image (DECRYPTED_IMAGE_PATH, std::ios::binary | std::ios::out);
 
-    const uint32_t ng = oc.ng();
+    if (Encryption::enabled)
+        std::cout << "Decrypting the update image: Size = " << image_size << std::endl;
 
-    // Construct DeviceChallenge for org
-    DeviceChallenge dc;
-    dc.set_id(ID);
-    dc.set_ng(ng);
-    
-    // Generate a random device nonce, N_D
-    const uint32_t nd = std::rand();
-    dc.set_nd(nd);
-    
-    dc.SerializeToString(&data);
+    // Protocol messages of other sessions go first
+    Encryption crypto (RSAPriority::BULK);
 
-    #ifdef ENCRYPT
-        // Determine pub key to use for encryption
-        RSAKey key;
-        if (org == Org::GU)
-            key = RSAKey::GU_PUB;
-        else if (org == Org::GC)
-            key = RSAKey::GC_PUB;
+    // Decrypt the image block by block rather than reading it into memory at once.
+    // The block buffers keep their capacity, so the loop doesn't allocate
+    std::string ciphertext, buffer;
+    std::streamoff remaining = image_size;
 
-        data = rsadriver.encrypt(data, key);
-    #endif
+    while (remaining > 0) {
+        TraceSpan span ("Decrypt block");
 
-    M2 m2;
-    m2.set_dc(data);
-    m2.SerializeToString(&data);
+        const std::streamoff block_size = remaining < DECRYPT_BLOCK_SIZE ? remaining : DECRYPT_BLOCK_SIZE;
+        remaining -= block_size;
 
-    // Send back to org
-    socket.send(asio::buffer(data));
+        ciphertext.resize(block_size);
+        image.read(&ciphertext[0], block_size);
 
-    // Get final reply from org as M3
-    len = socket.receive(asio::buffer(buf));
-    data = std::string(buf.begin(), buf.begin() + len);
+        // Only the last block ends with the length padding
+        const std::string& plaintext = crypto.decrypt(ciphertext, buffer, remaining == 0);
 
-    M3 m3;
-    valid = m3.ParseFromString(data);
+        if (!check.update(plaintext.data(), plaintext.size()))
+            return false;
 
-    if (!valid) {
-        print_binary_string(data);
-        std::cout << "Error parsing M3 from: " << org << std::endl;
-        return false;
+        // Write to disk
+        decrypted_image.write(plaintext.data(), plaintext.size());
     }
 
-    #ifdef ENCRYPT
-        data = rsadriver.decrypt(m3.or_());
-    #else
-        data = m3.or_();
-    #endif
+    decrypted_image.close();
 
-    // Parse OrgResponse
-    OrgResponse ur;
-    valid = ur.ParseFromString(data);
+    return true;
+}
 
-    if (!valid) {
-        print_binary_string(data);
-        std::cout << "Error parsing OrgResponse from: " << org << std::endl;
-        return false;
-    }
+template <typename Debug, typename Cores>
+bool expand_image() {
+    /**
+     * Turns the decrypted image into a full update image. Compressed images are
+     * decompressed first, then for delta images the patch is applied to the
+     * currently installed image.
+     */
+    ImageHeader header;
 
-    // Check nonce sent from org
-    if (ur.nd() != nd) {
-        std::cout << "Organization " << org << " authentication failed!";
+    if (!read_image_header(DECRYPTED_IMAGE_PATH, header))
         return false;
-    }
 
-    if (org == Org::GU) {
-        // Get image length
-        len = socket.receive(asio::buffer(buf));
-        data = std::string(buf.begin(), buf.begin() + len);
-        
-        UpdateImage ui;
-        ui.ParseFromString(data);
-        uint32_t image_size = ui.size();
+    if (header.flags & IMAGE_FLAG_COMPRESSED) {
+        TraceSpan span ("Decompress");
 
-        // Tell server to start sending the update image
-        socket.send(asio::buffer("OK"));
+        if (!decompress_image(DECRYPTED_IMAGE_PATH, DECOMPRESSED_IMAGE_PATH))
+            return false;
 
-        // Receive the update image and write to IMAGE_PATH on disk
-        receive_image(socket, image_size);
-    }
-    
-    else if (org == Org::GC) {
-        // Retrieve hash from the org
-        hash = ur.hc();
+        if (std::rename(DECOMPRESSED_IMAGE_PATH, DECRYPTED_IMAGE_PATH) != 0)
+            return false;
     }
 
-    return true;
-}
-
-void read_image_header(const char* path) {
-    // NOTE: function assumes image has exactly 3 fields!
-    // i.e., BOOT.bin, image.ub, and application (in that order)
-    std::ifstream image (path, std::ios::binary | std::ios::in);
-    uint32_t seek_pos = 1; // Skip length byte at start of file
-    
-    image.read(reinterpret_cast<char *>(&image_header.s1), 4);
-    
-    seek_pos += 4;
-    image.seekg(seek_pos);
-    image.read(reinterpret_cast<char *>(&image_header.s2), 4);
-    
-    seek_pos += 4;
-    image.seekg(seek_pos);
-    image.read(reinterpret_cast<char *>(&image_header.s3), 4);
-    
-    seek_pos += 4;
-    
-    // Read in hash byte-by-byte
-    uint8_t byte;
-    
-    for (int i = 0; i < HASH_SIZE; i++) {
-        image.seekg(seek_pos + i);
-        image.read(reinterpret_cast<char *>(&byte), 1);
-        image_header.hash.push_back(byte);
-    }
+    // Nothing else to do for full images
+    if (!(header.flags & IMAGE_FLAG_DELTA))
+        return true;
 
-    image.close();
-}
+    if (Debug::enabled)
+        std::cout << "Applying delta image to " << CURRENT_IMAGE_PATH << std::endl;
 
-std::streampos get_file_size(const char* path) {
-    std::streampos fsize = 0;
-    std::ifstream file(path, std::ios::binary);
+    TraceSpan span ("Apply delta");
 
-    fsize = file.tellg();
-    file.seekg(0, std::ios::end);
-    fsize = file.tellg() - fsize;
-    file.close();
+    if (!apply_delta<typename Cores::SHA3>(CURRENT_IMAGE_PATH, DECRYPTED_IMAGE_PATH, PATCHED_IMAGE_PATH))
+        return false;
 
-    return fsize;
+    return std::rename(PATCHED_IMAGE_PATH, DECRYPTED_IMAGE_PATH) == 0;
 }
 
-bool decrypt_image() {
-    auto image_size = get_file_size(IMAGE_PATH);
-    
-    // Ciphertext
-    std::string ciphertext;
-    ciphertext.reserve(image_size);
-
-    // Read entire update image into memory
-    std::ifstream image (IMAGE_PATH, std::ios::binary | std::ios::in);
-    std::ostringstream oss;
-    oss << image.rdbuf();
-    ciphertext = oss.str();
-    image.close();
-
-    // Decrypt the image
-    #ifdef ENCRYPT
-        std::cout << "Decrypting the update image: Size = " << image_size << std::endl;
-        RSADriver rsadriver;
-        std::string plaintext = rsadriver.decrypt(ciphertext);
-    #else
-        std::string plaintext = ciphertext;
-    #endif
+template <typename SHA3>
+std::string compute_image_hash() {
+    TraceSpan span ("Hash");
 
-    // Write to disk
-    std::ofstream decrypted_image (DECRYPTED_IMAGE_PATH, std::ios::binary | std::ios::out);
-    decrypted_image.write(plaintext.data(), plaintext.size());
+    // Read in image header (an unreadable image has no hash)
+    if (!read_image_header(DECRYPTED_IMAGE_PATH, image_header))
+        return std::string();
 
-    decrypted_image.close();
+    // Open image and seek to correct start position in file
+    std::ifstream image (DECRYPTED_IMAGE_PATH, std::ios::binary | std::ios::in);
+    image.seekg(image_header.size()); // See server/update_image.py for header structure
 
-    return true;
-}
+    SHA3 driver;
+    driver.begin();
 
-std::string compute_image_hash() {
-    // NOTE: this function assumes 3 fields in the image header
-    
-    // Read in image header
-    read_image_header(DECRYPTED_IMAGE_PATH);
+    // Stream the file contents through the hash core
+    std::vector<char> buf (65536);
 
-    // Open image and seek to correct start position in file
-    std::ifstream image (DECRYPTED_IMAGE_PATH, std::ios::binary | std::ios::in);
-    image.seekg(1 + 12 + HASH_SIZE); // See server/update_image.py for header structure
+    while (image.read(buf.data(), buf.size()) || image.gcount() > 0)
+        driver.update(buf.data(), image.gcount());
 
-    // Read out the file contents for hashing
-    std::ostringstream oss;
-    oss << image.rdbuf();
-    std::string content = oss.str();
     image.close();
 
-    SHA3Driver driver;
-    
     // Compute hash
-    return driver.compute_hash(content, false);
+    return driver.finalize(false);
 }
 
-bool validate_hashes(std::vector<std::string>& hashes) {
-    std::string hash = compute_image_hash();
+template <typename Debug, typename Cores>
+bool validate_hashes(std::vector<std::string>& hashes, const std::string& body_hash) {
+    /**
+     * Checks the image body against its header hash, and the confirming hashes
+     * against that. body_hash is the hash of the image body if it was computed
+     * while decrypting, or empty. Compressed and delta images are only hashed
+     * here, after expand_image() rebuilt the full image.
+     */
+    std::string hash;
+
+    if (body_hash.empty()) {
+        hash = compute_image_hash<typename Cores::SHA3>();
+    } else {
+        hash = body_hash;
+        read_image_header(DECRYPTED_IMAGE_PATH, image_header);
+    }
 
     if (hash.compare(image_header.hash) != 0) {
         std::cout << "Header and content hashes are different!" << std::endl;
+        return false;
     }
 
     // Check confirming hashes against update image hash
@@ -345,7 +247,7 @@ bool validate_hashes(std::vector<std::string>& hashes) {
         if (h.compare(image_header.hash) != 0) {
             std::cout << "Hash mismatch detected!" << std::endl;
 
-            #ifdef DEBUG
+            if (Debug::enabled) {
                 // Print out all 3 hashes
                 for (int i = 0; i < HASH_SIZE; i++)
                     std::cout << std::hex << (int)hash.at(i) << " ";
@@ -361,7 +263,7 @@ bool validate_hashes(std::vector<std::string>& hashes) {
                     std::cout << std::hex << (int)image_header.hash.at(i) << " ";
             
                 std::cout << std::endl;
-            #endif
+            }
 
             return false;
         }
@@ -370,98 +272,575 @@ bool validate_hashes(std::vector<std::string>& hashes) {
     return true;
 }
 
-void execute_update() {
+bool read_installed_version(uint32_t& version) {
+    /**
+     * Reads the version of the installed update image into version. Returns
+     * false if no update was installed yet.
+     */
+    std::ifstream file (CURRENT_VERSION_PATH);
+    uint32_t installed;
+
+    if (!(file >> installed))
+        return false;
+
+    version = installed;
+    return true;
+}
+
+void execute_update(uint32_t version) {
+    TraceSpan span ("Extract");
+
     // Extract image into seperate files (BOOT.bin, image.ub, application)
 
     // Back up old files on SD card (shell?)
     
     // Move new files to SD card (shell?)
+
+    // Keep the new image as the base for future delta updates
+    std::rename(DECRYPTED_IMAGE_PATH, CURRENT_IMAGE_PATH);
+
+    // Record its version, so the device reports it after a restart as well
+    std::ofstream file (CURRENT_VERSION_TEMP_PATH, std::ios::out | std::ios::trunc);
+    file << version << std::endl;
+    file.close();
+
+    std::rename(CURRENT_VERSION_TEMP_PATH, CURRENT_VERSION_PATH);
 }
 
-int main(int argc, char** argv) {
-    if (argc < 3) {
-        std::cout << "Usage: zynq-updater <ip> <port>" << std::endl;
-        return 0;
+uint64_t bench_random(uint64_t& state) {
+    // xorshift64*: fast filler for synthetic image bodies (not cryptographic)
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 2685821657736338717ULL;
+}
+
+void generate_body_block(uint64_t& state, std::vector<char>& block, size_t length) {
+    for (size_t i = 0; i < length; i += 8) {
+        const uint64_t value = bench_random(state);
+        std::memcpy(&block[i], &value, length - i < 8 ? length - i : 8);
     }
+}
 
-    // Get host and port from cmdline args
-    const char* server_host = argv[1];
-    const uint32_t port = std::stoi(argv[2], nullptr);
+bool generate_bench_image(uint32_t num_fields, uint32_t image_size, bool hybrid, ImageHeader& header) {
+    /**
+     * Generates a synthetic full image with num_fields fields totalling image_size
+     * body bytes, and writes it encrypted to the device key to BENCH_SOURCE_PATH
+     * as the server would send it. In hybrid mode the body is encrypted with
+     * AES-CTR and session_key is set to the RSA encrypted key || nonce.
+     *
+     * The body is generated twice from the same seed: once to compute the
+     * header hash, then again while encrypting, so memory use is bounded.
+     */
+    const uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    std::vector<char> block (DECRYPT_BLOCK_SIZE);
+
+    header.flags = 0;
+    header.sizes.assign(num_fields, image_size / num_fields);
+    header.sizes.back() += image_size % num_fields;
+
+    // First pass: hash the body
+    SHA3Driver sha3;
+    sha3.begin();
+
+    uint64_t state = seed;
+    for (uint32_t done = 0; done < image_size; done += block.size()) {
+        const size_t length = std::min<size_t>(block.size(), image_size - done);
+        generate_body_block(state, block, length);
+        sha3.update(block.data(), length);
+    }
 
-    try {
+    header.hash = sha3.finalize(false);
+
+    // Second pass: encrypt header and body
+    std::ofstream out (BENCH_SOURCE_PATH, std::ios::binary | std::ios::out);
+
+    std::ostringstream header_stream;
+    write_image_header(header_stream, header);
+
+    std::string plaintext = header_stream.str();
+    RSADriver rsadriver;
+
+    if (hybrid) {
+        std::string key (AES_SESSION_KEY_SIZE, 0);
+        random_bytes(&key[0], key.size());
+
+        session_key = rsadriver.encrypt(key, RSAKey::D_PUB);
+
+        const uint8_t* key_ptr = reinterpret_cast<const uint8_t *>(key.data());
+        AESCTR aes (key_ptr, key_ptr + AES_KEY_SIZE);
+
+        aes.apply(reinterpret_cast<uint8_t *>(&plaintext[0]), plaintext.size());
+        out.write(plaintext.data(), plaintext.size());
+
+        state = seed;
+        for (uint32_t done = 0; done < image_size; done += block.size()) {
+            const size_t length = std::min<size_t>(block.size(), image_size - done);
+            generate_body_block(state, block, length);
+            aes.apply(reinterpret_cast<uint8_t *>(block.data()), length);
+            out.write(block.data(), length);
+        }
+    } else {
+        session_key.clear();
+
+        // Encrypt whole PKCS#1 chunks as they fill up; only the final call pads
+        const size_t rsa_block = (DECRYPT_BLOCK_SIZE / RSA_CHUNK_SIZE) * PKCS1_CHUNK_SIZE;
+
+        state = seed;
+        for (uint32_t done = 0; done < image_size; done += block.size()) {
+            const size_t length = std::min<size_t>(block.size(), image_size - done);
+            generate_body_block(state, block, length);
+            plaintext.append(block.data(), length);
+
+            while (plaintext.size() > rsa_block) {
+                const std::string ciphertext = rsadriver.encrypt(plaintext.substr(0, rsa_block), RSAKey::D_PUB, false);
+                out.write(ciphertext.data(), ciphertext.size());
+                plaintext.erase(0, rsa_block);
+            }
+        }
+
+        const std::string ciphertext = rsadriver.encrypt(plaintext, RSAKey::D_PUB);
+        out.write(ciphertext.data(), ciphertext.size());
+    }
+
+    out.close();
+
+    return out.good();
+}
+
+void serve_bench_image(tcp::acceptor& acceptor, asio::io_service& io_service) {
+    /**
+     * Loopback image source: sends BENCH_SOURCE_PATH to a single client and
+     * waits for its acknowledgement, like the server does after UpdateImage.
+     */
+    tcp::socket peer (io_service);
+    acceptor.accept(peer);
+
+    std::ifstream image (BENCH_SOURCE_PATH, std::ios::binary | std::ios::in);
+    std::vector<char> buf (65536);
+
+    while (image.read(buf.data(), buf.size()) || image.gcount() > 0)
+        asio::write(peer, asio::buffer(buf.data(), image.gcount()));
+
+    char ack[3];
+    asio::read(peer, asio::buffer(ack));
+}
+
+long peak_rss() {
+    // Peak resident set size in KB
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void print_bench_stage(const char* stage, double seconds, uint32_t image_size) {
+    std::cout << std::left << std::setw(12) << stage
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << seconds
+              << std::setw(12) << (seconds > 0 ? image_size / seconds / 1048576.0 : 0.0)
+              << std::setw(16) << peak_rss() << std::endl;
+}
+
+bool run_bench_update(uint32_t num_fields, uint32_t image_size, bool hybrid) {
+    /**
+     * Runs the receive, decrypt, hash and extract stages of an update on a
+     * synthetic image and prints the time, throughput and peak RSS after each.
+     */
+    typedef std::chrono::steady_clock bench_clock;
+    auto seconds_since = [](const bench_clock::time_point& start) {
+        return std::chrono::duration<double>(bench_clock::now() - start).count();
+    };
+
+    std::cout << "Image: " << num_fields << " fields, " << (image_size / 1048576) << " MB, "
+              << (hybrid ? "AES-CTR" : "RSA") << std::endl;
+
+    ImageHeader header;
+    auto start = bench_clock::now();
+
+    if (!generate_bench_image(num_fields, image_size, hybrid, header)) {
+        std::cout << "Failed to generate benchmark image!" << std::endl;
+        return false;
+    }
+
+    std::cout << "Generated in " << seconds_since(start) << " s" << std::endl;
+    std::cout << std::left << std::setw(12) << "stage" << std::right << std::setw(12) << "seconds"
+              << std::setw(12) << "MB/s" << std::setw(16) << "peak RSS (KB)" << std::endl;
+
+    const auto total_start = bench_clock::now();
+
+    // Receive over loopback
+    start = bench_clock::now();
+    {
         asio::io_service io_service;
-        asio::ip::tcp::endpoint endpoint (asio::ip::address::from_string(server_host), port);
-        
+        tcp::acceptor acceptor (io_service, tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+        std::thread source (serve_bench_image, std::ref(acceptor), std::ref(io_service));
+
         tcp::socket socket (io_service);
-        socket.connect(endpoint);
+        socket.connect(tcp::endpoint(asio::ip::address_v4::loopback(), acceptor.local_endpoint().port()));
+        UpdateSession session (socket, ID, VERSION);
+        session.image_path = IMAGE_PATH;
+        session.receive_image(get_file_size(BENCH_SOURCE_PATH));
 
-        // Send update check to server
-        send_update_check(socket);
+        source.join();
+    }
+    print_bench_stage("Receive", seconds_since(start), image_size);
 
-        // Variables to store hashes received from orgs
-        std::vector<std::string> hashes;
-        std::string hash;
-        hash.reserve(64);
+    // Unwrap the session key and decrypt
+    start = bench_clock::now();
+    if (hybrid) {
+        RSADriver rsadriver;
+        session_key = rsadriver.decrypt(session_key);
+    }
+    ImageCheck<SHA3Driver> no_check ("");
+    decrypt_image<Encrypted>(no_check);
+    print_bench_stage("Decrypt", seconds_since(start), image_size);
 
-        // Start timing the protocol
-        const auto start = std::chrono::high_resolution_clock::now();
+    // Hash and compare against the header
+    start = bench_clock::now();
+    const std::string hash = compute_image_hash<SHA3Driver>();
+    print_bench_stage("Hash", seconds_since(start), image_size);
 
-        // Run protocol for GU
-        bool success = run_protocol(socket, Org::GU, hash);
-        
-        // Run protocol for all GC,i
+    if (hash.compare(header.hash) != 0) {
+        std::cout << "Hash mismatch detected!" << std::endl;
+        return false;
+    }
+
+    // Split into field files
+    start = bench_clock::now();
+    if (!extract_image(DECRYPTED_IMAGE_PATH, BENCH_FIELD_PREFIX)) {
+        std::cout << "Failed to extract image!" << std::endl;
+        return false;
+    }
+    print_bench_stage("Extract", seconds_since(start), image_size);
+
+    print_bench_stage("Total", seconds_since(total_start), image_size);
+
+    // Clean up
+    std::remove(BENCH_SOURCE_PATH);
+    std::remove(IMAGE_PATH);
+    std::remove(DECRYPTED_IMAGE_PATH);
+
+    for (uint32_t i = 0; i < num_fields; i++)
+        std::remove((BENCH_FIELD_PREFIX + std::to_string(i) + ".bin").c_str());
+
+    return true;
+}
+
+int run_benchmark(int argc, char** argv) {
+    /**
+     * zynq-updater --bench[-rsa] <num_fields> <size_mb>...
+     *
+     * Runs the update pipeline locally for each image size. Does not touch the
+     * installed image; run it from a scratch directory.
+     */
+    if (argc < 4) {
+        std::cout << "Usage: zynq-updater --bench[-rsa] <num_fields> <size_mb>..." << std::endl;
+        return 0;
+    }
+
+    const bool hybrid = std::string(argv[1]) == "--bench";
+    const uint32_t num_fields = std::stoi(argv[2], nullptr);
+
+    if (num_fields < 1 || num_fields > IMAGE_FIELD_MASK) {
+        std::cout << "Number of fields must be between 1 and " << IMAGE_FIELD_MASK << std::endl;
+        return 1;
+    }
+
+    for (int i = 3; i < argc; i++) {
+        const uint32_t image_size = std::stoi(argv[i], nullptr) * 1048576;
+
+        if (!run_bench_update(num_fields, image_size, hybrid))
+            return 1;
+
+        std::cout << std::endl;
+    }
+
+    RSADriver::counters.print(std::cout);
+    RSADriver::software_counters.print(std::cout);
+    SHA3Driver::counters.print(std::cout);
+
+    return 0;
+}
+
+template <typename Encryption, typename Debug, typename Cores>
+bool run_update(asio::io_service& io_service, const tcp::endpoint& endpoint, UpdaterConfig& config, uint32_t quorum) {
+    /**
+     * Runs the protocol with the orgs, then decrypts, checks and installs the
+     * update image. Instantiated for each encryption, debug and core policy.
+     * Returns true if an update was installed, and sets config.version to it.
+     */
+    tcp::socket socket (io_service);
+    socket.connect(endpoint);
+
+    UpdateSession session (socket, config.id, config.version);
+    session.image_path = IMAGE_PATH;
+    session.encrypt = Encryption::enabled;
+    session.broker = Cores::broker;
+
+    // A delta only applies to the image it was built against (none on first install)
+    ImageHeader installed_header;
+
+    if (read_image_header(CURRENT_IMAGE_PATH, installed_header))
+        session.installed_hash = installed_header.hash;
+
+    // Ask the server for an update. When there is none, that's the only
+    // round trip: no confirming org connections and no crypto core work
+    if (!session.check_for_update()) {
+        if (session.up_to_date)
+            std::cout << "Device is up to date." << std::endl;
+        else
+            std::cout << "Protocol failed!" << std::endl;
+
+        return false;
+    }
+
+    // Variables to store hashes received from orgs
+    std::vector<std::string> hashes;
+    std::string hash;
+    hash.reserve(64);
+
+    // Hash of a full image body, computed while decrypting
+    std::string body_hash;
+
+    // Start timing the protocol
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    // The server's UpdateStatus tells whether the confirming orgs have their own endpoints
+    ConfirmingOrgs confirming_orgs (config.id, config.version);
+    bool confirmed = false;
+
+    if (session.parallel_auth) {
+        // Authenticate all G_C,i on their own connections while authenticating G_U
+        confirming_orgs.encrypt = Encryption::enabled;
+        confirming_orgs.broker = Cores::broker;
+        confirming_orgs.start(config.orgs);
+
+        // Only download the image once a quorum of orgs agree on its hash
+        session.confirm_image = [&]() {
+            confirmed = confirming_orgs.wait_for_quorum(quorum, hashes);
+
+            if (!confirmed && !confirming_orgs.up_to_date)
+                std::cout << "No quorum of " << quorum << " matching confirming hashes, skipping the download!" << std::endl;
+
+            return confirmed;
+        };
+    }
+
+    // Run protocol for GU
+    TraceSpan gu_span ("Protocol", "GU");
+    bool success = session.run_protocol(Org::GU, hash);
+    gu_span.end();
+
+    session_key = session.session_key;
+
+    if (session.parallel_auth) {
+        socket.close();
+
+        success = success && confirmed;
+    } else {
+        // Run protocol for each GC,i in turn (only the key slot of each org is used)
         if (success) {
-            for (int i = 0; i < NUM_ORGS-1; i++) {
+            std::vector<std::string> org_hashes;
+
+            for (size_t i = 0; i < config.orgs.size() && count_matching(org_hashes, hash) < quorum; i++) {
                 // Returns the hash sent by G_C,i
-                success = run_protocol(socket, Org::GC, hash);
-                hashes.push_back(hash);
-                
-                // Stop checking if one org fails
-                if (!success) {
+                TraceSpan gc_span ("Protocol", "GC");
+                const bool org_success = session.run_protocol(Org::GC, hash, config.orgs[i].key);
+                gc_span.end();
+
+                if (org_success)
+                    org_hashes.push_back(hash);
+                else
                     std::cout << "Confirming org #" << i << " failed the protocol!" << std::endl;
-                }
             }
+
+            // Keep the hashes that form the quorum
+            if (count_matching(org_hashes, hash) >= quorum)
+                hashes.assign(quorum, hash);
+            else
+                success = false;
         }
 
         socket.close();
+    }
 
-        // Auth completed
-        const auto t2 = std::chrono::high_resolution_clock::now();
+    // Auth completed
+    const auto t2 = std::chrono::high_resolution_clock::now();
 
-        if (success) {
-            const auto auth_time = std::chrono::duration_cast<std::chrono::microseconds>(t2 - start).count() / 1000000.0;
-            std::cout << "Authentication completed successfully in " << auth_time << std::endl;
+    // Without agreeing hashes there is nothing to check the image against
+    success = success && !hashes.empty();
+
+    if (success) {
+        const auto auth_time = std::chrono::duration_cast<std::chrono::microseconds>(t2 - start).count() / 1000000.0;
+        std::cout << "Authentication completed successfully in " << auth_time << std::endl;
+
+        // Decrypt the update image (if applicable), checking it against the confirmed hash on the way
+        ImageCheck<typename Cores::SHA3> check (hashes[0]);
+        success = decrypt_image<Encryption>(check) && check.finalize(body_hash);
 
-            // Decrypt the update image (if applicable)
-            decrypt_image();
+        if (!success)
+            std::cout << "Update image doesn't match the confirmed hash!" << std::endl;
 
-            const auto t3 = std::chrono::high_resolution_clock::now();
-            const auto dec_time = std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count() / 1000000.0;
-            std::cout << "Image decrypted in " << dec_time << std::endl;
+        // Rebuild the full image from a compressed and/or delta update
+        if (success) {
+            success = expand_image<Debug, Cores>();
+
+            if (!success)
+                std::cout << "Failed to expand update image!" << std::endl;
         }
 
         const auto t3 = std::chrono::high_resolution_clock::now();
+        const auto dec_time = std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count() / 1000000.0;
+        std::cout << "Image decrypted in " << dec_time << std::endl;
+    }
 
-        // Check all received hashes
-        if (success && hashes.size() == NUM_ORGS-1 && validate_hashes(hashes)) {
-            const auto t4 = std::chrono::high_resolution_clock::now();
-            const auto hash_time = std::chrono::duration_cast<std::chrono::microseconds>(t4 - t3).count() / 1000000.0;
-            std::cout << "Hash validation completed in " << hash_time << std::endl;
+    const auto t3 = std::chrono::high_resolution_clock::now();
 
-            std::cout << "Executing update..." << std::endl;
-            execute_update();
-            
-            // Compute time elapsed for current run
-            const auto end = std::chrono::high_resolution_clock::now();
-            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-            
-            std::cout << std::dec << "Protocol completed successfully in " << (duration/1000000.0) << " seconds and all hashes match!" << std::endl;
-        } else {
-            std::cout << "Protocol failed!" << std::endl;
+    // Check all received hashes
+    if (success && hashes.size() == quorum && validate_hashes<Debug, Cores>(hashes, body_hash)) {
+        const auto t4 = std::chrono::high_resolution_clock::now();
+        const auto hash_time = std::chrono::duration_cast<std::chrono::microseconds>(t4 - t3).count() / 1000000.0;
+        std::cout << "Hash validation completed in " << hash_time << std::endl;
+
+        std::cout << "Executing update..." << std::endl;
+        execute_update(session.update_version);
+        config.version = session.update_version;
+        
+        // Compute time elapsed for current run
+        const auto end = std::chrono::high_resolution_clock::now();
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        
+        std::cout << std::dec << "Protocol completed successfully in " << (duration/1000000.0) << " seconds and all hashes match!" << std::endl;
+        return true;
+    }
+
+    std::cout << "Protocol failed!" << std::endl;
+    return false;
+}
+
+typedef bool (*UpdateRunner)(asio::io_service&, const tcp::endpoint&, UpdaterConfig&, uint32_t);
+
+void run_daemon(asio::io_service& io_service, const tcp::endpoint& endpoint, UpdaterConfig& config, uint32_t quorum, UpdateRunner run) {
+    /**
+     * Checks for an update at startup, then whenever the server announces a
+     * release on the notification channel. Polling is only a fallback for a
+     * lost channel, so it can be rare. Announcements reach all devices at
+     * once: the random delay spreads their checks out.
+     */
+    UpdateNotifier notifier (io_service, tcp::endpoint(endpoint.address(), config.notify_port));
+
+    while (true) {
+        try {
+            run(io_service, endpoint, config, quorum);
+        } catch (std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+
+        const auto poll_interval = std::chrono::seconds(DAEMON_POLL_INTERVAL / 2) + jitter(DAEMON_POLL_INTERVAL / 2);
+
+        if (notifier.wait(poll_interval)) {
+            std::cout << "Release announced" << std::endl;
+            std::this_thread::sleep_for(jitter(ANNOUNCE_JITTER));
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]).compare(0, 7, "--bench") == 0)
+        return run_benchmark(argc, argv);
+
+    // Keep running and update on release announcements
+    const bool daemon = argc > 1 && std::string(argv[1]) == "--daemon";
+
+    if (argc < 3 + daemon) {
+        std::cout << "Usage: zynq-updater <ip> <port> [trace.json]" << std::endl;
+        std::cout << "       zynq-updater --daemon <ip> <port>" << std::endl;
+        std::cout << "       zynq-updater --bench[-rsa] <num_fields> <size_mb>..." << std::endl;
+        return 0;
+    }
+
+    // Get host and port from cmdline args
+    const char* server_host = argv[1 + daemon];
+    const uint32_t port = std::stoi(argv[2 + daemon], nullptr);
+
+    // Record per-phase spans if a trace output path is given
+    const char* trace_path = (!daemon && argc > 3) ? argv[3] : NULL;
+
+    if (trace_path)
+        Tracer::instance().enable();
+
+    UpdaterConfig config;
+
+    try {
+        asio::io_service io_service;
+        asio::ip::tcp::endpoint endpoint (asio::ip::address::from_string(server_host), port);
+
+        // Device settings and confirming orgs (by default at the ports following G_U)
+        config.id = ID;
+        config.version = VERSION;
+        config.orgs = default_confirming_orgs(endpoint, NUM_CONFIRMING_ORGS);
+        config.notify_port = port - 1;
+
+        if (!load_config(CONFIG_PATH, config))
+            return 1;
+
+        // Once an update is installed, its version replaces the configured one
+        read_installed_version(config.version);
+
+        // Software contexts of the public keys loaded into the PL
+        for (const PublicKey& public_key : config.public_keys)
+            RSADriver::set_public_key(public_key.key, public_key.modulus);
+
+        // The broker owns the cores, so it must be running already
+        if (config.broker && !BrokerConnection::thread_connection().connected())
+            return 1;
+
+        // By default, all confirming orgs must agree
+        const uint32_t quorum = config.quorum ? config.quorum : config.orgs.size();
+
+        if (config.orgs.empty() || quorum == 0) {
+            std::cout << "At least one confirming org must agree on the update" << std::endl;
+            return 1;
         }
+
+        if (quorum > config.orgs.size()) {
+            std::cout << "Quorum of " << quorum << " needs more than the " << config.orgs.size() << " confirming orgs" << std::endl;
+            return 1;
+        }
+
+        // Pick the core, encryption and debug variants once for the whole update
+        const UpdateRunner runners[2][2][2] = {
+            {
+                {run_update<Plaintext, Quiet, DirectCores>, run_update<Plaintext, Verbose, DirectCores>},
+                {run_update<Encrypted, Quiet, DirectCores>, run_update<Encrypted, Verbose, DirectCores>}
+            },
+            {
+                {run_update<Plaintext, Quiet, BrokerCores>, run_update<Plaintext, Verbose, BrokerCores>},
+                {run_update<BrokerEncrypted, Quiet, BrokerCores>, run_update<BrokerEncrypted, Verbose, BrokerCores>}
+            }
+        };
+
+        const UpdateRunner run = runners[config.broker][config.encrypt][config.debug];
+
+        if (daemon)
+            run_daemon(io_service, endpoint, config, quorum, run);
+        else
+            run(io_service, endpoint, config, quorum);
     } catch (std::exception& e) {
         std::cerr << e.what() << std::endl;
     }
 
+    // The broker's cores are counted on its side
+    if (config.debug && !config.broker) {
+        // Hardware core usage, e.g., poll spins per completion
+        RSADriver::counters.print(std::cout);
+        RSADriver::software_counters.print(std::cout);
+        SHA3Driver::counters.print(std::cout);
+        RSADriver::scheduler().print(std::cout);
+    }
+
+    if (trace_path)
+        Tracer::instance().dump(trace_path);
+
     return 0;
 }
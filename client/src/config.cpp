@@ -0,0 +1,113 @@
+#include "config.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+using asio::ip::tcp;
+
+bool parse_org(std::istringstream& line, ConfirmingOrg& org) {
+    std::string address;
+    uint32_t port, key;
+
+    // Org keys are public keys in the slots from GC_PUB on
+    if (!(line >> address >> port >> key) || port > 65535 || key < RSAKey::GC_PUB || key >= RSA_KEY_SLOTS)
+        return false;
+
+    asio::error_code error;
+    const asio::ip::address ip = asio::ip::address::from_string(address, error);
+
+    if (error)
+        return false;
+
+    org.endpoint = tcp::endpoint(ip, port);
+    org.key = static_cast<RSAKey>(key);
+
+    return true;
+}
+
+bool parse_public_key(std::istringstream& line, PublicKey& public_key) {
+    uint32_t key;
+    std::string modulus;
+
+    // Only the public slots hold keys with a public modulus
+    if (!(line >> key >> modulus) || key < RSAKey::D_PUB || key >= RSA_KEY_SLOTS)
+        return false;
+
+    // An odd RSA-512 modulus with the top bit set
+    if (modulus.size() != 2 * RSA_CHUNK_SIZE || modulus.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+        return false;
+
+    if (std::string("13579bdfBDF").find(modulus.back()) == std::string::npos || std::string("01234567").find(modulus[0]) != std::string::npos)
+        return false;
+
+    public_key.key = static_cast<RSAKey>(key);
+    public_key.modulus = modulus;
+
+    return true;
+}
+
+bool load_config(const char* path, UpdaterConfig& config) {
+    std::ifstream file (path);
+
+    if (!file)
+        return true;
+
+    std::vector<ConfirmingOrg> orgs;
+    std::string text;
+    uint32_t line_number = 0;
+
+    while (std::getline(file, text)) {
+        line_number++;
+
+        std::istringstream line (text);
+        std::string setting;
+
+        // Skip blank lines and comments
+        if (!(line >> setting) || setting[0] == '#')
+            continue;
+
+        bool valid;
+
+        if (setting == "id") {
+            valid = static_cast<bool>(line >> config.id);
+        } else if (setting == "version") {
+            valid = static_cast<bool>(line >> config.version);
+        } else if (setting == "quorum") {
+            valid = (line >> config.quorum) && config.quorum > 0;
+        } else if (setting == "encrypt") {
+            valid = static_cast<bool>(line >> config.encrypt);
+        } else if (setting == "debug") {
+            valid = static_cast<bool>(line >> config.debug);
+        } else if (setting == "broker") {
+            valid = static_cast<bool>(line >> config.broker);
+        } else if (setting == "notify") {
+            valid = (line >> config.notify_port) && config.notify_port <= 65535;
+        } else if (setting == "pubkey") {
+            PublicKey public_key;
+            valid = parse_public_key(line, public_key);
+
+            if (valid)
+                config.public_keys.push_back(public_key);
+        } else if (setting == "org") {
+            ConfirmingOrg org;
+            valid = parse_org(line, org);
+
+            if (valid)
+                orgs.push_back(org);
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            std::cout << path << ":" << line_number << ": invalid setting: " << text << std::endl;
+            return false;
+        }
+    }
+
+    // Orgs in the file replace the default list
+    if (!orgs.empty())
+        config.orgs = orgs;
+
+    return true;
+}
@@ -0,0 +1,153 @@
+#include "csprng.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__linux__)
+    #include <unistd.h>
+    #include <sys/syscall.h>
+#endif
+
+static inline uint32_t rotl(uint32_t x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+static inline uint32_t load_le(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void store_le(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+#define QUARTER_ROUND(a, b, c, d) \
+    a += b; d = rotl(d ^ a, 16);  \
+    c += d; b = rotl(b ^ c, 12);  \
+    a += b; d = rotl(d ^ a, 8);   \
+    c += d; b = rotl(b ^ c, 7);
+
+void chacha20_block(const uint8_t* key, uint32_t counter, const uint8_t* nonce, uint8_t* out) {
+    /**
+     * Computes one 64 byte block of ChaCha20 key stream: 20 rounds over the
+     * state (constants, key, counter, nonce), added to the initial state.
+     */
+    uint32_t state[16] = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+
+    for (int i = 0; i < 8; i++)
+        state[4 + i] = load_le(key + 4 * i);
+
+    state[12] = counter;
+
+    for (int i = 0; i < 3; i++)
+        state[13 + i] = load_le(nonce + 4 * i);
+
+    uint32_t x[16];
+    std::memcpy(x, state, sizeof(x));
+
+    // 10 double rounds: columns, then diagonals
+    for (int i = 0; i < 10; i++) {
+        QUARTER_ROUND(x[0], x[4], x[8],  x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9],  x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8],  x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9],  x[14]);
+    }
+
+    for (int i = 0; i < 16; i++)
+        store_le(out + 4 * i, x[i] + state[i]);
+}
+
+static void os_random(uint8_t* out, size_t length) {
+    /**
+     * Reads seed material from the kernel: getrandom() where the kernel has
+     * it, /dev/urandom otherwise.
+     */
+    #if defined(__linux__) && defined(SYS_getrandom)
+        while (length > 0) {
+            const long n = syscall(SYS_getrandom, out, length, 0);
+
+            if (n <= 0)
+                break;
+
+            out += n;
+            length -= n;
+        }
+
+        if (length == 0)
+            return;
+    #endif
+
+    std::ifstream urandom ("/dev/urandom", std::ios::binary | std::ios::in);
+
+    if (!urandom.read(reinterpret_cast<char *>(out), length))
+        throw std::runtime_error("No source of random seed");
+}
+
+CSPRNG::CSPRNG() {
+    os_random(key, sizeof(key));
+}
+
+CSPRNG::~CSPRNG() {
+    // Don't leave key material behind in freed memory
+    volatile uint8_t* p = key;
+    for (size_t i = 0; i < sizeof(key); i++)
+        p[i] = 0;
+}
+
+void CSPRNG::refill() {
+    /**
+     * Generates a buffer of key stream under the current key (zero nonce,
+     * counter from 0). Its first 32 bytes become the next key and are never
+     * handed out.
+     */
+    static const uint8_t nonce[CHACHA_NONCE_SIZE] = {0};
+
+    for (uint32_t i = 0; i < CSPRNG_BUFFER_BLOCKS; i++)
+        chacha20_block(key, i, nonce, buffer + i * CHACHA_BLOCK_SIZE);
+
+    std::memcpy(key, buffer, CHACHA_KEY_SIZE);
+    used = CHACHA_KEY_SIZE;
+}
+
+void CSPRNG::fill(void* out, size_t length) {
+    uint8_t* ptr = static_cast<uint8_t *>(out);
+
+    while (length > 0) {
+        if (used == sizeof(buffer))
+            this->refill();
+
+        const size_t n = (length < sizeof(buffer) - used) ? length : sizeof(buffer) - used;
+
+        std::memcpy(ptr, buffer + used, n);
+
+        // Output is handed out once
+        std::memset(buffer + used, 0, n);
+
+        used += n;
+        ptr += n;
+        length -= n;
+    }
+}
+
+static CSPRNG& thread_generator() {
+    // One generator per thread, so no locking is needed
+    thread_local CSPRNG generator;
+    return generator;
+}
+
+void random_bytes(void* out, size_t length) {
+    thread_generator().fill(out, length);
+}
+
+uint32_t random_word() {
+    uint32_t value;
+    random_bytes(&value, sizeof(value));
+    return value;
+}
@@ -0,0 +1,133 @@
+#include "delta.hpp"
+
+#include <iostream>
+#include <vector>
+
+#include "sha3driver.hpp"
+#include "broker.hpp"
+
+// Copies length bytes from input to output (and the hash core) using a fixed size buffer
+template <typename SHA3>
+static bool stream_bytes(std::ifstream& input, std::ofstream& output, SHA3& sha3,
+                         std::vector<char>& buf, uint32_t length) {
+    while (length > 0) {
+        const uint32_t n = length < buf.size() ? length : buf.size();
+
+        if (!input.read(buf.data(), n))
+            return false;
+
+        output.write(buf.data(), n);
+        sha3.update(buf.data(), n);
+
+        length -= n;
+    }
+
+    return true;
+}
+
+template <typename SHA3>
+bool apply_delta(const char* base_path, const char* delta_path, const char* output_path) {
+    /**
+     * Patches the installed (base) image into a new full image by streaming the patch
+     * operations of the delta image. Memory use is bounded by DELTA_BUFFER_SIZE,
+     * regardless of image size.
+     *
+     * Arguments:
+     *     - base_path: currently installed update image
+     *     - delta_path: decrypted delta image
+     *     - output_path: path to write the full update image to
+     *
+     * Returns: true if the patched image body matches the hash in the delta header
+     */
+    ImageHeader base_header, delta_header;
+
+    if (!read_image_header(base_path, base_header)) {
+        std::cout << "No installed image to apply the delta to!" << std::endl;
+        return false;
+    }
+
+    if (!read_image_header(delta_path, delta_header) || !(delta_header.flags & IMAGE_FLAG_DELTA)) {
+        std::cout << "Invalid delta image!" << std::endl;
+        return false;
+    }
+
+    // The delta must have been built against the installed image
+    if (delta_header.base_hash.compare(base_header.hash) != 0) {
+        std::cout << "Delta image does not apply to the installed image!" << std::endl;
+        return false;
+    }
+
+    std::ifstream base (base_path, std::ios::binary | std::ios::in);
+    std::ifstream delta (delta_path, std::ios::binary | std::ios::in);
+    std::ofstream output (output_path, std::ios::binary | std::ios::out);
+
+    delta.seekg(delta_header.size());
+
+    // Output is a regular full image with the target header
+    ImageHeader output_header = delta_header;
+    output_header.flags &= ~IMAGE_FLAG_DELTA;
+    write_image_header(output, output_header);
+
+    SHA3 sha3;
+    sha3.begin();
+
+    std::vector<char> buf (DELTA_BUFFER_SIZE);
+
+    const uint64_t base_body_size = base_header.body_size();
+    uint64_t written = 0;
+
+    uint8_t op;
+    uint32_t offset, length;
+
+    while (delta.read(reinterpret_cast<char *>(&op), 1)) {
+        if (op == DELTA_OP_COPY) {
+            delta.read(reinterpret_cast<char *>(&offset), 4);
+            delta.read(reinterpret_cast<char *>(&length), 4);
+
+            if (!delta || (uint64_t)offset + length > base_body_size) {
+                std::cout << "Invalid COPY operation in delta image!" << std::endl;
+                return false;
+            }
+
+            base.seekg(base_header.size() + offset);
+
+            if (!stream_bytes(base, output, sha3, buf, length))
+                return false;
+        }
+
+        else if (op == DELTA_OP_DATA) {
+            delta.read(reinterpret_cast<char *>(&length), 4);
+
+            if (!delta || !stream_bytes(delta, output, sha3, buf, length)) {
+                std::cout << "Truncated DATA operation in delta image!" << std::endl;
+                return false;
+            }
+        }
+
+        else {
+            std::cout << "Unknown operation in delta image: " << (int)op << std::endl;
+            return false;
+        }
+
+        written += length;
+    }
+
+    output.close();
+
+    if (written != output_header.body_size()) {
+        std::cout << "Patched image size mismatch!" << std::endl;
+        return false;
+    }
+
+    // Verify the patched body against the target hash
+    if (sha3.finalize(false).compare(delta_header.hash) != 0) {
+        std::cout << "Patched image hash mismatch!" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// Variants used by the updater (see DirectCores and BrokerCores in policy.hpp)
+template bool apply_delta<SHA3Driver>(const char*, const char*, const char*);
+template bool apply_delta<BrokerSHA3Driver>(const char*, const char*, const char*);
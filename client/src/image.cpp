@@ -0,0 +1,174 @@
+#include "image.hpp"
+
+#include <sstream>
+
+#include "broker.hpp" // for BrokerSHA3Driver
+
+uint32_t ImageHeader::size() const {
+    // Field count + field sizes + hash(es)
+    uint32_t size = 1 + sizes.size() * 4 + HASH_SIZE;
+
+    if (flags & IMAGE_FLAG_DELTA)
+        size += HASH_SIZE;
+
+    return size;
+}
+
+uint64_t ImageHeader::body_size() const {
+    uint64_t size = 0;
+
+    for (const uint32_t& s: sizes)
+        size += s;
+
+    return size;
+}
+
+bool read_image_header(const char* path, ImageHeader& header) {
+    std::ifstream image (path, std::ios::binary | std::ios::in);
+
+    if (!image)
+        return false;
+
+    return read_image_header(image, header);
+}
+
+bool read_image_header(std::istream& image, ImageHeader& header) {
+    // First byte holds both the number of fields and the image flags
+    uint8_t num_fields;
+    image.read(reinterpret_cast<char *>(&num_fields), 1);
+
+    header.flags = num_fields & ~IMAGE_FIELD_MASK;
+    num_fields &= IMAGE_FIELD_MASK;
+
+    // Read in each length field
+    header.sizes.resize(num_fields);
+
+    for (uint8_t i = 0; i < num_fields; i++)
+        image.read(reinterpret_cast<char *>(&header.sizes[i]), 4);
+
+    // Read in hash(es)
+    header.hash.resize(HASH_SIZE);
+    image.read(&header.hash[0], HASH_SIZE);
+
+    if (header.flags & IMAGE_FLAG_DELTA) {
+        header.base_hash.resize(HASH_SIZE);
+        image.read(&header.base_hash[0], HASH_SIZE);
+    } else {
+        header.base_hash.clear();
+    }
+
+    return image.good();
+}
+
+void write_image_header(std::ostream& image, const ImageHeader& header) {
+    const uint8_t num_fields = header.sizes.size() | header.flags;
+    image.write(reinterpret_cast<const char *>(&num_fields), 1);
+
+    for (const uint32_t& s: header.sizes)
+        image.write(reinterpret_cast<const char *>(&s), 4);
+
+    image.write(header.hash.data(), HASH_SIZE);
+
+    if (header.flags & IMAGE_FLAG_DELTA)
+        image.write(header.base_hash.data(), HASH_SIZE);
+}
+
+bool extract_image(const char* path, const char* prefix) {
+    ImageHeader header;
+
+    if (!read_image_header(path, header) || header.flags != 0)
+        return false;
+
+    std::ifstream image (path, std::ios::binary | std::ios::in);
+    image.seekg(header.size());
+
+    std::vector<char> buf (65536);
+
+    for (size_t i = 0; i < header.sizes.size(); i++) {
+        const std::string field_path = prefix + std::to_string(i) + ".bin";
+        std::ofstream field (field_path, std::ios::binary | std::ios::out);
+
+        // Copy the field through a fixed size buffer
+        uint32_t remaining = header.sizes[i];
+
+        while (remaining > 0) {
+            const uint32_t length = remaining < buf.size() ? remaining : buf.size();
+
+            if (!image.read(buf.data(), length))
+                return false;
+
+            field.write(buf.data(), length);
+            remaining -= length;
+        }
+
+        if (!field)
+            return false;
+    }
+
+    return true;
+}
+
+template <typename SHA3>
+bool ImageCheck<SHA3>::update(const char* data, size_t length) {
+    if (confirmed_hash.empty())
+        return true;
+
+    if (rejected)
+        return false;
+
+    if (!header_done) {
+        // Collect the start of the image until the whole header can be read
+        header_data.append(data, length);
+
+        std::istringstream stream (header_data);
+
+        if (!read_image_header(stream, header))
+            return true;
+
+        header_done = true;
+
+        if (header.hash.compare(confirmed_hash) != 0) {
+            rejected = true;
+            return false;
+        }
+
+        // Compressed and delta bodies are hashed after they are expanded
+        hash_body = (header.flags == 0);
+
+        if (hash_body) {
+            sha3.begin();
+            sha3.update(header_data.data() + header.size(), header_data.size() - header.size());
+        }
+
+        header_data.clear();
+        return true;
+    }
+
+    if (hash_body)
+        sha3.update(data, length);
+
+    return true;
+}
+
+template <typename SHA3>
+bool ImageCheck<SHA3>::finalize(std::string& body_hash) {
+    body_hash.clear();
+
+    if (confirmed_hash.empty())
+        return true;
+
+    // Image ended before its header
+    if (rejected || !header_done)
+        return false;
+
+    if (!hash_body)
+        return true;
+
+    body_hash = sha3.finalize(false);
+
+    return body_hash.compare(confirmed_hash) == 0;
+}
+
+// Variants used by the updater (see DirectCores and BrokerCores in policy.hpp)
+template class ImageCheck<SHA3Driver>;
+template class ImageCheck<BrokerSHA3Driver>;
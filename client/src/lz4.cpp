@@ -0,0 +1,192 @@
+#include "lz4.hpp"
+
+#include <iostream>
+#include <vector>
+#include <cstring>
+
+#include "image.hpp"
+
+static int64_t decode_block(const uint8_t* src, size_t src_size,
+                            uint8_t* dst_start, size_t dst_pos, size_t dst_capacity) {
+    /**
+     * Decodes a single LZ4 block into dst_start + dst_pos. Matches may refer to data
+     * previously decoded into dst_start (i.e., the window).
+     *
+     * Returns: number of bytes decoded, or -1 for malformed input
+     */
+    const uint8_t* ip = src;
+    const uint8_t* const ip_end = src + src_size;
+    uint8_t* op = dst_start + dst_pos;
+    uint8_t* const op_end = dst_start + dst_capacity;
+
+    while (ip < ip_end) {
+        const uint8_t token = *ip++;
+
+        // Literal length, extended with 255-valued bytes
+        size_t length = token >> 4;
+
+        if (length == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ip_end)
+                    return -1;
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+        }
+
+        if (length > (size_t)(ip_end - ip) || length > (size_t)(op_end - op))
+            return -1;
+
+        std::memcpy(op, ip, length);
+        ip += length;
+        op += length;
+
+        // Last sequence of the block has literals only
+        if (ip == ip_end)
+            break;
+
+        if (ip_end - ip < 2)
+            return -1;
+
+        const size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+
+        if (offset == 0 || offset > (size_t)(op - dst_start))
+            return -1;
+
+        // Match length (minimum of 4), extended with 255-valued bytes
+        length = (token & 0xF) + 4;
+
+        if ((token & 0xF) == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ip_end)
+                    return -1;
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+        }
+
+        if (length > (size_t)(op_end - op))
+            return -1;
+
+        // Copy byte-by-byte since the match may overlap the output
+        const uint8_t* match = op - offset;
+        for (size_t i = 0; i < length; i++)
+            *op++ = *match++;
+    }
+
+    return op - (dst_start + dst_pos);
+}
+
+int64_t lz4_decompress_frame(std::ifstream& input, std::ofstream& output) {
+    /**
+     * Streaming LZ4 frame decoder. The window holds the last LZ4_WINDOW_SIZE bytes
+     * of output followed by the block currently being decoded, so memory use is
+     * bounded regardless of the size of the frame.
+     */
+    uint32_t magic;
+    uint8_t flg, bd;
+
+    input.read(reinterpret_cast<char *>(&magic), 4);
+    input.read(reinterpret_cast<char *>(&flg), 1);
+    input.read(reinterpret_cast<char *>(&bd), 1);
+
+    if (!input || magic != LZ4_MAGIC || (flg & 0xC0) != LZ4_FLG_VERSION) {
+        std::cout << "Invalid LZ4 frame header!" << std::endl;
+        return -1;
+    }
+
+    // Block maximum size ID 4 is 64 KB
+    if (((bd >> 4) & 0x7) != 4) {
+        std::cout << "LZ4 block size too large: " << ((bd >> 4) & 0x7) << std::endl;
+        return -1;
+    }
+
+    // Skip content size, dictionary ID and header checksum
+    // NOTE: integrity is checked through the image hash instead
+    uint32_t skip = 1;
+
+    if (flg & LZ4_FLG_SIZE)
+        skip += 8;
+
+    if (flg & LZ4_FLG_DICT_ID)
+        skip += 4;
+
+    input.seekg(skip, std::ios::cur);
+
+    std::vector<uint8_t> block (LZ4_BLOCK_SIZE);
+    std::vector<uint8_t> window (LZ4_WINDOW_SIZE + LZ4_BLOCK_SIZE);
+
+    // Number of valid bytes in the window
+    size_t window_size = 0;
+
+    int64_t total = 0;
+    uint32_t block_size;
+
+    while (input.read(reinterpret_cast<char *>(&block_size), 4)) {
+        // EndMark
+        if (block_size == 0)
+            break;
+
+        const bool uncompressed = block_size & LZ4_UNCOMPRESSED;
+        block_size &= ~LZ4_UNCOMPRESSED;
+
+        if (block_size > LZ4_BLOCK_SIZE || !input.read(reinterpret_cast<char *>(block.data()), block_size)) {
+            std::cout << "Invalid LZ4 block!" << std::endl;
+            return -1;
+        }
+
+        if (flg & LZ4_FLG_BLOCK_CSUM)
+            input.seekg(4, std::ios::cur);
+
+        // Keep only the last LZ4_WINDOW_SIZE bytes of history before decoding
+        if (window_size > LZ4_WINDOW_SIZE) {
+            std::memmove(window.data(), window.data() + window_size - LZ4_WINDOW_SIZE, LZ4_WINDOW_SIZE);
+            window_size = LZ4_WINDOW_SIZE;
+        }
+
+        int64_t decoded;
+
+        if (uncompressed) {
+            std::memcpy(window.data() + window_size, block.data(), block_size);
+            decoded = block_size;
+        } else {
+            decoded = decode_block(block.data(), block_size, window.data(), window_size, window.size());
+        }
+
+        if (decoded < 0) {
+            std::cout << "Corrupted LZ4 block!" << std::endl;
+            return -1;
+        }
+
+        output.write(reinterpret_cast<char *>(window.data() + window_size), decoded);
+
+        window_size += decoded;
+        total += decoded;
+    }
+
+    if (flg & LZ4_FLG_CONTENT_CSUM)
+        input.seekg(4, std::ios::cur);
+
+    return total;
+}
+
+bool decompress_image(const char* input_path, const char* output_path) {
+    ImageHeader header;
+
+    if (!read_image_header(input_path, header) || !(header.flags & IMAGE_FLAG_COMPRESSED))
+        return false;
+
+    std::ifstream input (input_path, std::ios::binary | std::ios::in);
+    std::ofstream output (output_path, std::ios::binary | std::ios::out);
+
+    input.seekg(header.size());
+
+    // Uncompressed image has the same header, minus the compressed flag
+    header.flags &= ~IMAGE_FLAG_COMPRESSED;
+    write_image_header(output, header);
+
+    return lz4_decompress_frame(input, output) >= 0;
+}
@@ -0,0 +1,129 @@
+#include "notify.hpp"
+
+#include <thread>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <poll.h>
+
+#include "csprng.hpp"
+
+typedef std::chrono::steady_clock notify_clock;
+
+std::chrono::milliseconds jitter(uint32_t max_seconds) {
+    return std::chrono::milliseconds(random_word() % (max_seconds * 1000 + 1));
+}
+
+bool UpdateNotifier::connect() {
+    if (notify_clock::now() < next_attempt)
+        return false;
+
+    asio::error_code error;
+    socket.connect(endpoint, error);
+
+    if (error) {
+        this->disconnect();
+        return false;
+    }
+
+    buffered = 0;
+    last_message = notify_clock::now();
+
+    return true;
+}
+
+void UpdateNotifier::disconnect() {
+    /**
+     * Closes the connection (if open) and schedules the next attempt after a
+     * random part of the current backoff, which then doubles.
+     */
+    asio::error_code error;
+    socket.close(error);
+
+    buffered = 0;
+    next_attempt = notify_clock::now() + jitter(backoff);
+    backoff = std::min(backoff * 2, (uint32_t)NOTIFY_BACKOFF_MAX);
+}
+
+bool UpdateNotifier::parse() {
+    bool announced = false;
+
+    while (true) {
+        bool available, parallel_auth;
+        const size_t size = parse_update_status(buf, buffered, available, parallel_auth);
+
+        if (size == 0)
+            break;
+
+        announced |= available;
+
+        std::memmove(buf, buf + size, buffered - size);
+        buffered -= size;
+
+        // The server is reachable again
+        backoff = NOTIFY_BACKOFF_MIN;
+    }
+
+    // A full buffer without a single notification is not the server speaking
+    if (buffered == sizeof(buf))
+        this->disconnect();
+
+    return announced;
+}
+
+bool UpdateNotifier::wait(notify_clock::duration timeout) {
+    const auto deadline = notify_clock::now() + timeout;
+
+    while (true) {
+        const auto now = notify_clock::now();
+
+        if (now >= deadline)
+            return false;
+
+        if (!socket.is_open() && !this->connect()) {
+            std::this_thread::sleep_until(std::min(next_attempt, deadline));
+            continue;
+        }
+
+        // Wake up for the deadline or when the server has been silent for too long
+        const auto silent_until = last_message + std::chrono::seconds(NOTIFY_TIMEOUT);
+
+        if (now >= silent_until) {
+            this->disconnect();
+            continue;
+        }
+
+        const auto wake = std::min(deadline, silent_until);
+        const int wait_ms = std::chrono::duration_cast<std::chrono::milliseconds>(wake - now).count() + 1;
+
+        struct pollfd fd;
+        fd.fd = socket.native_handle();
+        fd.events = POLLIN;
+
+        const int ready = poll(&fd, 1, wait_ms);
+
+        if (ready < 0 && errno != EINTR) {
+            this->disconnect();
+            continue;
+        }
+
+        if (ready <= 0)
+            continue;
+
+        asio::error_code error;
+        const size_t len = socket.receive(asio::buffer(buf + buffered, sizeof(buf) - buffered), 0, error);
+
+        // Closed by the server, e.g., on restart
+        if (error || len == 0) {
+            this->disconnect();
+            continue;
+        }
+
+        buffered += len;
+        last_message = notify_clock::now();
+
+        if (this->parse())
+            return true;
+    }
+}
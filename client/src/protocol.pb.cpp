@@ -1,447 +1,447 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: protocol.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "protocol.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
-class UpdateCheckDefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<UpdateCheck>
-     _instance;
-} _UpdateCheck_default_instance_;
-class UpdateStatusDefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<UpdateStatus>
-     _instance;
-} _UpdateStatus_default_instance_;
-class OrgChallengeDefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<OrgChallenge>
-     _instance;
-} _OrgChallenge_default_instance_;
-class DeviceChallengeDefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<DeviceChallenge>
-     _instance;
-} _DeviceChallenge_default_instance_;
-class OrgResponseDefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<OrgResponse>
-     _instance;
-} _OrgResponse_default_instance_;
-class M1DefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<M1>
-     _instance;
-} _M1_default_instance_;
-class M2DefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<M2>
-     _instance;
-} _M2_default_instance_;
-class M3DefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<M3>
-     _instance;
-} _M3_default_instance_;
-class UpdateImageDefaultTypeInternal {
-public:
- ::google::protobuf::internal::ExplicitlyConstructed<UpdateImage>
-     _instance;
-} _UpdateImage_default_instance_;
-
-namespace protobuf_protocol_2eproto {
-
-
-namespace {
-
-::google::protobuf::Metadata file_level_metadata[9];
-
-}  // namespace
-
-PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTableField
-    const TableStruct::entries[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  {0, 0, 0, ::google::protobuf::internal::kInvalidMask, 0, 0},
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR UpdateCheck::UpdateCheck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hi_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.v_)*/0u
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateCheckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateCheckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateCheckDefaultTypeInternal() {}
+  union {
+    UpdateCheck _instance;
+  };
 };
-
-PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::AuxillaryParseTableField
-    const TableStruct::aux[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  ::google::protobuf::internal::AuxillaryParseTableField(),
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateCheckDefaultTypeInternal _UpdateCheck_default_instance_;
+PROTOBUF_CONSTEXPR UpdateStatus::UpdateStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.successful_)*/false
+  , /*decltype(_impl_.parallel_auth_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateStatusDefaultTypeInternal() {}
+  union {
+    UpdateStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateStatusDefaultTypeInternal _UpdateStatus_default_instance_;
+PROTOBUF_CONSTEXPR OrgChallenge::OrgChallenge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ng_)*/uint64_t{0u}
+  , /*decltype(_impl_.ig_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OrgChallengeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OrgChallengeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OrgChallengeDefaultTypeInternal() {}
+  union {
+    OrgChallenge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrgChallengeDefaultTypeInternal _OrgChallenge_default_instance_;
+PROTOBUF_CONSTEXPR DeviceChallenge::DeviceChallenge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ng_)*/uint64_t{0u}
+  , /*decltype(_impl_.nd_)*/uint64_t{0u}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeviceChallengeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeviceChallengeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeviceChallengeDefaultTypeInternal() {}
+  union {
+    DeviceChallenge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeviceChallengeDefaultTypeInternal _DeviceChallenge_default_instance_;
+PROTOBUF_CONSTEXPR OrgResponse::OrgResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hc_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nd_)*/uint64_t{0u}
+  , /*decltype(_impl_.ig_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OrgResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OrgResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OrgResponseDefaultTypeInternal() {}
+  union {
+    OrgResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OrgResponseDefaultTypeInternal _OrgResponse_default_instance_;
+PROTOBUF_CONSTEXPR M1::M1(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.oc_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.v_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct M1DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR M1DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~M1DefaultTypeInternal() {}
+  union {
+    M1 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 M1DefaultTypeInternal _M1_default_instance_;
+PROTOBUF_CONSTEXPR M2::M2(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dc_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct M2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR M2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~M2DefaultTypeInternal() {}
+  union {
+    M2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 M2DefaultTypeInternal _M2_default_instance_;
+PROTOBUF_CONSTEXPR M3::M3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.or__)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct M3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR M3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~M3DefaultTypeInternal() {}
+  union {
+    M3 _instance;
+  };
 };
-PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
-    TableStruct::schema[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
-  { NULL, NULL, 0, -1, -1, -1, -1, NULL, false },
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 M3DefaultTypeInternal _M3_default_instance_;
+PROTOBUF_CONSTEXPR UpdateImage::UpdateImage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sk_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateImageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateImageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateImageDefaultTypeInternal() {}
+  union {
+    UpdateImage _instance;
+  };
 };
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateImageDefaultTypeInternal _UpdateImage_default_instance_;
+static ::_pb::Metadata file_level_metadata_protocol_2eproto[9];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_protocol_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_protocol_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateCheck, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::UpdateCheck, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateCheck, v_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateCheck, id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::UpdateCheck, _impl_.v_),
+  PROTOBUF_FIELD_OFFSET(::UpdateCheck, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::UpdateCheck, _impl_.hi_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateStatus, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::UpdateStatus, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateStatus, successful_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::UpdateStatus, _impl_.successful_),
+  PROTOBUF_FIELD_OFFSET(::UpdateStatus, _impl_.parallel_auth_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgChallenge, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::OrgChallenge, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgChallenge, ng_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgChallenge, ig_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::OrgChallenge, _impl_.ng_),
+  PROTOBUF_FIELD_OFFSET(::OrgChallenge, _impl_.ig_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeviceChallenge, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::DeviceChallenge, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeviceChallenge, ng_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeviceChallenge, nd_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DeviceChallenge, id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::DeviceChallenge, _impl_.ng_),
+  PROTOBUF_FIELD_OFFSET(::DeviceChallenge, _impl_.nd_),
+  PROTOBUF_FIELD_OFFSET(::DeviceChallenge, _impl_.id_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::OrgResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgResponse, nd_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgResponse, ig_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OrgResponse, hc_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::OrgResponse, _impl_.nd_),
+  PROTOBUF_FIELD_OFFSET(::OrgResponse, _impl_.ig_),
+  PROTOBUF_FIELD_OFFSET(::OrgResponse, _impl_.hc_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M1, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::M1, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M1, v_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M1, oc_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::M1, _impl_.v_),
+  PROTOBUF_FIELD_OFFSET(::M1, _impl_.oc_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M2, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::M2, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M2, dc_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::M2, _impl_.dc_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M3, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::M3, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(M3, or__),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::M3, _impl_.or__),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateImage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::UpdateImage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(UpdateImage, size_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::UpdateImage, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::UpdateImage, _impl_.sk_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(UpdateCheck)},
-  { 7, -1, sizeof(UpdateStatus)},
-  { 13, -1, sizeof(OrgChallenge)},
-  { 20, -1, sizeof(DeviceChallenge)},
-  { 28, -1, sizeof(OrgResponse)},
-  { 36, -1, sizeof(M1)},
-  { 43, -1, sizeof(M2)},
-  { 49, -1, sizeof(M3)},
-  { 55, -1, sizeof(UpdateImage)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::UpdateCheck)},
+  { 9, -1, -1, sizeof(::UpdateStatus)},
+  { 17, -1, -1, sizeof(::OrgChallenge)},
+  { 25, -1, -1, sizeof(::DeviceChallenge)},
+  { 34, -1, -1, sizeof(::OrgResponse)},
+  { 43, -1, -1, sizeof(::M1)},
+  { 51, -1, -1, sizeof(::M2)},
+  { 58, -1, -1, sizeof(::M3)},
+  { 65, -1, -1, sizeof(::UpdateImage)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&_UpdateCheck_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_UpdateStatus_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_OrgChallenge_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_DeviceChallenge_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_OrgResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_M1_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_M2_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_M3_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&_UpdateImage_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_UpdateCheck_default_instance_._instance,
+  &::_UpdateStatus_default_instance_._instance,
+  &::_OrgChallenge_default_instance_._instance,
+  &::_DeviceChallenge_default_instance_._instance,
+  &::_OrgResponse_default_instance_._instance,
+  &::_M1_default_instance_._instance,
+  &::_M2_default_instance_._instance,
+  &::_M3_default_instance_._instance,
+  &::_UpdateImage_default_instance_._instance,
 };
 
-namespace {
-
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  ::google::protobuf::MessageFactory* factory = NULL;
-  AssignDescriptors(
-      "protocol.proto", schemas, file_default_instances, TableStruct::offsets, factory,
-      file_level_metadata, NULL, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 9);
-}
-
-}  // namespace
-void TableStruct::InitDefaultsImpl() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::internal::InitProtobufDefaults();
-  _UpdateCheck_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_UpdateCheck_default_instance_);_UpdateStatus_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_UpdateStatus_default_instance_);_OrgChallenge_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_OrgChallenge_default_instance_);_DeviceChallenge_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_DeviceChallenge_default_instance_);_OrgResponse_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_OrgResponse_default_instance_);_M1_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_M1_default_instance_);_M2_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_M2_default_instance_);_M3_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_M3_default_instance_);_UpdateImage_default_instance_._instance.DefaultConstruct();
-  ::google::protobuf::internal::OnShutdownDestroyMessage(
-      &_UpdateImage_default_instance_);}
-
-void InitDefaults() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &TableStruct::InitDefaultsImpl);
-}
-namespace {
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\016protocol.proto\"$\n\013UpdateCheck\022\t\n\001V\030\001 \001"
-      "(\r\022\n\n\002ID\030\002 \001(\r\"\"\n\014UpdateStatus\022\022\n\nsucces"
-      "sful\030\001 \001(\010\"&\n\014OrgChallenge\022\n\n\002NG\030\001 \001(\004\022\n"
-      "\n\002IG\030\002 \001(\r\"5\n\017DeviceChallenge\022\n\n\002NG\030\001 \001("
-      "\004\022\n\n\002ND\030\002 \001(\004\022\n\n\002ID\030\003 \001(\r\"1\n\013OrgResponse"
-      "\022\n\n\002ND\030\001 \001(\004\022\n\n\002IG\030\002 \001(\r\022\n\n\002HC\030\003 \001(\014\"\033\n\002"
-      "M1\022\t\n\001V\030\001 \001(\r\022\n\n\002OC\030\002 \001(\014\"\020\n\002M2\022\n\n\002DC\030\001 "
-      "\001(\014\"\020\n\002M3\022\n\n\002OR\030\001 \001(\014\"\033\n\013UpdateImage\022\014\n\004"
-      "size\030\001 \001(\rb\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 338);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "protocol.proto", &protobuf_RegisterTypes);
-}
-} // anonymous namespace
-
-void AddDescriptors() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+const char descriptor_table_protodef_protocol_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016protocol.proto\"0\n\013UpdateCheck\022\t\n\001V\030\001 \001"
+  "(\r\022\n\n\002ID\030\002 \001(\r\022\n\n\002HI\030\003 \001(\014\"9\n\014UpdateStat"
+  "us\022\022\n\nsuccessful\030\001 \001(\010\022\025\n\rparallel_auth\030"
+  "\002 \001(\010\"&\n\014OrgChallenge\022\n\n\002NG\030\001 \001(\004\022\n\n\002IG\030"
+  "\002 \001(\r\"5\n\017DeviceChallenge\022\n\n\002NG\030\001 \001(\004\022\n\n\002"
+  "ND\030\002 \001(\004\022\n\n\002ID\030\003 \001(\r\"1\n\013OrgResponse\022\n\n\002N"
+  "D\030\001 \001(\004\022\n\n\002IG\030\002 \001(\r\022\n\n\002HC\030\003 \001(\014\"\033\n\002M1\022\t\n"
+  "\001V\030\001 \001(\r\022\n\n\002OC\030\002 \001(\014\"\020\n\002M2\022\n\n\002DC\030\001 \001(\014\"\020"
+  "\n\002M3\022\n\n\002OR\030\001 \001(\014\"\'\n\013UpdateImage\022\014\n\004size\030"
+  "\001 \001(\r\022\n\n\002SK\030\002 \001(\014B\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_protocol_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_protocol_2eproto = {
+    false, false, 390, descriptor_table_protodef_protocol_2eproto,
+    "protocol.proto",
+    &descriptor_table_protocol_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_protocol_2eproto::offsets,
+    file_level_metadata_protocol_2eproto, file_level_enum_descriptors_protocol_2eproto,
+    file_level_service_descriptors_protocol_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_protocol_2eproto_getter() {
+  return &descriptor_table_protocol_2eproto;
 }
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-
-}  // namespace protobuf_protocol_2eproto
 
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_protocol_2eproto(&descriptor_table_protocol_2eproto);
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UpdateCheck::kVFieldNumber;
-const int UpdateCheck::kIDFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UpdateCheck::_Internal {
+ public:
+};
 
-UpdateCheck::UpdateCheck()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:UpdateCheck)
+UpdateCheck::UpdateCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:UpdateCheck)
 }
 UpdateCheck::UpdateCheck(const UpdateCheck& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&v_, &from.v_,
-    static_cast<size_t>(reinterpret_cast<char*>(&id_) -
-    reinterpret_cast<char*>(&v_)) + sizeof(id_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateCheck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hi_){}
+    , decltype(_impl_.v_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hi().empty()) {
+    _this->_impl_.hi_.Set(from._internal_hi(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.v_, &from._impl_.v_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.v_)) + sizeof(_impl_.id_));
   // @@protoc_insertion_point(copy_constructor:UpdateCheck)
 }
 
-void UpdateCheck::SharedCtor() {
-  ::memset(&v_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&id_) -
-      reinterpret_cast<char*>(&v_)) + sizeof(id_));
-  _cached_size_ = 0;
+inline void UpdateCheck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hi_){}
+    , decltype(_impl_.v_){0u}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.hi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UpdateCheck::~UpdateCheck() {
   // @@protoc_insertion_point(destructor:UpdateCheck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UpdateCheck::SharedDtor() {
+inline void UpdateCheck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hi_.Destroy();
 }
 
 void UpdateCheck::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* UpdateCheck::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const UpdateCheck& UpdateCheck::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-UpdateCheck* UpdateCheck::New(::google::protobuf::Arena* arena) const {
-  UpdateCheck* n = new UpdateCheck;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void UpdateCheck::Clear() {
 // @@protoc_insertion_point(message_clear_start:UpdateCheck)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&v_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&id_) -
-      reinterpret_cast<char*>(&v_)) + sizeof(id_));
-  _internal_metadata_.Clear();
-}
-
-bool UpdateCheck::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:UpdateCheck)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.hi_.ClearToEmpty();
+  ::memset(&_impl_.v_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.id_) -
+      reinterpret_cast<char*>(&_impl_.v_)) + sizeof(_impl_.id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateCheck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 V = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &v_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.v_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 ID = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes HI = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_hi();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:UpdateCheck)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:UpdateCheck)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void UpdateCheck::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:UpdateCheck)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* UpdateCheck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:UpdateCheck)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 V = 1;
-  if (this->v() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->v(), output);
+  if (this->_internal_v() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_v(), target);
   }
 
   // uint32 ID = 2;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:UpdateCheck)
-}
-
-::google::protobuf::uint8* UpdateCheck::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:UpdateCheck)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 V = 1;
-  if (this->v() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->v(), target);
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_id(), target);
   }
 
-  // uint32 ID = 2;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->id(), target);
+  // bytes HI = 3;
+  if (!this->_internal_hi().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_hi(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:UpdateCheck)
   return target;
@@ -451,67 +451,55 @@ size_t UpdateCheck::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:UpdateCheck)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes HI = 3;
+  if (!this->_internal_hi().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hi());
   }
+
   // uint32 V = 1;
-  if (this->v() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->v());
+  if (this->_internal_v() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_v());
   }
 
   // uint32 ID = 2;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->id());
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateCheck::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:UpdateCheck)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateCheck* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const UpdateCheck>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:UpdateCheck)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:UpdateCheck)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateCheck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateCheck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateCheck::GetClassData() const { return &_class_data_; }
+
 
-void UpdateCheck::MergeFrom(const UpdateCheck& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:UpdateCheck)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void UpdateCheck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateCheck*>(&to_msg);
+  auto& from = static_cast<const UpdateCheck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:UpdateCheck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.v() != 0) {
-    set_v(from.v());
+  if (!from._internal_hi().empty()) {
+    _this->_internal_set_hi(from._internal_hi());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
+  if (from._internal_v() != 0) {
+    _this->_internal_set_v(from._internal_v());
   }
-}
-
-void UpdateCheck::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:UpdateCheck)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UpdateCheck::CopyFrom(const UpdateCheck& from) {
@@ -525,202 +513,162 @@ bool UpdateCheck::IsInitialized() const {
   return true;
 }
 
-void UpdateCheck::Swap(UpdateCheck* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void UpdateCheck::InternalSwap(UpdateCheck* other) {
   using std::swap;
-  swap(v_, other->v_);
-  swap(id_, other->id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata UpdateCheck::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// UpdateCheck
-
-// uint32 V = 1;
-void UpdateCheck::clear_v() {
-  v_ = 0u;
-}
-::google::protobuf::uint32 UpdateCheck::v() const {
-  // @@protoc_insertion_point(field_get:UpdateCheck.V)
-  return v_;
-}
-void UpdateCheck::set_v(::google::protobuf::uint32 value) {
-  
-  v_ = value;
-  // @@protoc_insertion_point(field_set:UpdateCheck.V)
-}
-
-// uint32 ID = 2;
-void UpdateCheck::clear_id() {
-  id_ = 0u;
-}
-::google::protobuf::uint32 UpdateCheck::id() const {
-  // @@protoc_insertion_point(field_get:UpdateCheck.ID)
-  return id_;
-}
-void UpdateCheck::set_id(::google::protobuf::uint32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:UpdateCheck.ID)
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hi_, lhs_arena,
+      &other->_impl_.hi_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UpdateCheck, _impl_.id_)
+      + sizeof(UpdateCheck::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(UpdateCheck, _impl_.v_)>(
+          reinterpret_cast<char*>(&_impl_.v_),
+          reinterpret_cast<char*>(&other->_impl_.v_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateCheck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[0]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UpdateStatus::kSuccessfulFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UpdateStatus::_Internal {
+ public:
+};
 
-UpdateStatus::UpdateStatus()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:UpdateStatus)
+UpdateStatus::UpdateStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:UpdateStatus)
 }
 UpdateStatus::UpdateStatus(const UpdateStatus& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  successful_ = from.successful_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.successful_){}
+    , decltype(_impl_.parallel_auth_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.successful_, &from._impl_.successful_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.parallel_auth_) -
+    reinterpret_cast<char*>(&_impl_.successful_)) + sizeof(_impl_.parallel_auth_));
   // @@protoc_insertion_point(copy_constructor:UpdateStatus)
 }
 
-void UpdateStatus::SharedCtor() {
-  successful_ = false;
-  _cached_size_ = 0;
+inline void UpdateStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.successful_){false}
+    , decltype(_impl_.parallel_auth_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 UpdateStatus::~UpdateStatus() {
   // @@protoc_insertion_point(destructor:UpdateStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UpdateStatus::SharedDtor() {
+inline void UpdateStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void UpdateStatus::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* UpdateStatus::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const UpdateStatus& UpdateStatus::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-UpdateStatus* UpdateStatus::New(::google::protobuf::Arena* arena) const {
-  UpdateStatus* n = new UpdateStatus;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void UpdateStatus::Clear() {
 // @@protoc_insertion_point(message_clear_start:UpdateStatus)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  successful_ = false;
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.successful_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.parallel_auth_) -
+      reinterpret_cast<char*>(&_impl_.successful_)) + sizeof(_impl_.parallel_auth_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool UpdateStatus::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:UpdateStatus)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* UpdateStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool successful = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &successful_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.successful_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool parallel_auth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.parallel_auth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:UpdateStatus)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:UpdateStatus)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void UpdateStatus::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:UpdateStatus)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* UpdateStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:UpdateStatus)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool successful = 1;
-  if (this->successful() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->successful(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (this->_internal_successful() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_successful(), target);
   }
-  // @@protoc_insertion_point(serialize_end:UpdateStatus)
-}
 
-::google::protobuf::uint8* UpdateStatus::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:UpdateStatus)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool successful = 1;
-  if (this->successful() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->successful(), target);
+  // bool parallel_auth = 2;
+  if (this->_internal_parallel_auth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_parallel_auth(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:UpdateStatus)
   return target;
@@ -730,55 +678,45 @@ size_t UpdateStatus::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:UpdateStatus)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bool successful = 1;
-  if (this->successful() != 0) {
+  if (this->_internal_successful() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void UpdateStatus::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:UpdateStatus)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateStatus* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const UpdateStatus>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:UpdateStatus)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:UpdateStatus)
-    MergeFrom(*source);
+  // bool parallel_auth = 2;
+  if (this->_internal_parallel_auth() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateStatus::MergeFrom(const UpdateStatus& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:UpdateStatus)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateStatus::GetClassData() const { return &_class_data_; }
+
+
+void UpdateStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateStatus*>(&to_msg);
+  auto& from = static_cast<const UpdateStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:UpdateStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.successful() != 0) {
-    set_successful(from.successful());
+  if (from._internal_successful() != 0) {
+    _this->_internal_set_successful(from._internal_successful());
   }
-}
-
-void UpdateStatus::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:UpdateStatus)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_parallel_auth() != 0) {
+    _this->_internal_set_parallel_auth(from._internal_parallel_auth());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UpdateStatus::CopyFrom(const UpdateStatus& from) {
@@ -792,218 +730,156 @@ bool UpdateStatus::IsInitialized() const {
   return true;
 }
 
-void UpdateStatus::Swap(UpdateStatus* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void UpdateStatus::InternalSwap(UpdateStatus* other) {
   using std::swap;
-  swap(successful_, other->successful_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata UpdateStatus::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UpdateStatus, _impl_.parallel_auth_)
+      + sizeof(UpdateStatus::_impl_.parallel_auth_)
+      - PROTOBUF_FIELD_OFFSET(UpdateStatus, _impl_.successful_)>(
+          reinterpret_cast<char*>(&_impl_.successful_),
+          reinterpret_cast<char*>(&other->_impl_.successful_));
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// UpdateStatus
-
-// bool successful = 1;
-void UpdateStatus::clear_successful() {
-  successful_ = false;
-}
-bool UpdateStatus::successful() const {
-  // @@protoc_insertion_point(field_get:UpdateStatus.successful)
-  return successful_;
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[1]);
 }
-void UpdateStatus::set_successful(bool value) {
-  
-  successful_ = value;
-  // @@protoc_insertion_point(field_set:UpdateStatus.successful)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int OrgChallenge::kNGFieldNumber;
-const int OrgChallenge::kIGFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class OrgChallenge::_Internal {
+ public:
+};
 
-OrgChallenge::OrgChallenge()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:OrgChallenge)
+OrgChallenge::OrgChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:OrgChallenge)
 }
 OrgChallenge::OrgChallenge(const OrgChallenge& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&ng_, &from.ng_,
-    static_cast<size_t>(reinterpret_cast<char*>(&ig_) -
-    reinterpret_cast<char*>(&ng_)) + sizeof(ig_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OrgChallenge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ng_){}
+    , decltype(_impl_.ig_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ng_, &from._impl_.ng_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ig_) -
+    reinterpret_cast<char*>(&_impl_.ng_)) + sizeof(_impl_.ig_));
   // @@protoc_insertion_point(copy_constructor:OrgChallenge)
 }
 
-void OrgChallenge::SharedCtor() {
-  ::memset(&ng_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ig_) -
-      reinterpret_cast<char*>(&ng_)) + sizeof(ig_));
-  _cached_size_ = 0;
+inline void OrgChallenge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ng_){uint64_t{0u}}
+    , decltype(_impl_.ig_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 OrgChallenge::~OrgChallenge() {
   // @@protoc_insertion_point(destructor:OrgChallenge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void OrgChallenge::SharedDtor() {
+inline void OrgChallenge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void OrgChallenge::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* OrgChallenge::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const OrgChallenge& OrgChallenge::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-OrgChallenge* OrgChallenge::New(::google::protobuf::Arena* arena) const {
-  OrgChallenge* n = new OrgChallenge;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void OrgChallenge::Clear() {
 // @@protoc_insertion_point(message_clear_start:OrgChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&ng_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ig_) -
-      reinterpret_cast<char*>(&ng_)) + sizeof(ig_));
-  _internal_metadata_.Clear();
-}
-
-bool OrgChallenge::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:OrgChallenge)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.ng_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ig_) -
+      reinterpret_cast<char*>(&_impl_.ng_)) + sizeof(_impl_.ig_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OrgChallenge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint64 NG = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &ng_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ng_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 IG = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &ig_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.ig_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:OrgChallenge)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:OrgChallenge)
-  return false;
-#undef DO_
-}
-
-void OrgChallenge::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:OrgChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint64 NG = 1;
-  if (this->ng() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->ng(), output);
-  }
-
-  // uint32 IG = 2;
-  if (this->ig() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->ig(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:OrgChallenge)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* OrgChallenge::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* OrgChallenge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:OrgChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint64 NG = 1;
-  if (this->ng() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->ng(), target);
+  if (this->_internal_ng() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_ng(), target);
   }
 
   // uint32 IG = 2;
-  if (this->ig() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->ig(), target);
+  if (this->_internal_ig() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ig(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:OrgChallenge)
   return target;
@@ -1013,67 +889,45 @@ size_t OrgChallenge::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:OrgChallenge)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint64 NG = 1;
-  if (this->ng() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->ng());
+  if (this->_internal_ng() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ng());
   }
 
   // uint32 IG = 2;
-  if (this->ig() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->ig());
+  if (this->_internal_ig() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ig());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void OrgChallenge::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:OrgChallenge)
-  GOOGLE_DCHECK_NE(&from, this);
-  const OrgChallenge* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const OrgChallenge>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:OrgChallenge)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:OrgChallenge)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OrgChallenge::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OrgChallenge::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OrgChallenge::GetClassData() const { return &_class_data_; }
+
 
-void OrgChallenge::MergeFrom(const OrgChallenge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:OrgChallenge)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void OrgChallenge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OrgChallenge*>(&to_msg);
+  auto& from = static_cast<const OrgChallenge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:OrgChallenge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.ng() != 0) {
-    set_ng(from.ng());
+  if (from._internal_ng() != 0) {
+    _this->_internal_set_ng(from._internal_ng());
   }
-  if (from.ig() != 0) {
-    set_ig(from.ig());
+  if (from._internal_ig() != 0) {
+    _this->_internal_set_ig(from._internal_ig());
   }
-}
-
-void OrgChallenge::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:OrgChallenge)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void OrgChallenge::CopyFrom(const OrgChallenge& from) {
@@ -1087,258 +941,172 @@ bool OrgChallenge::IsInitialized() const {
   return true;
 }
 
-void OrgChallenge::Swap(OrgChallenge* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void OrgChallenge::InternalSwap(OrgChallenge* other) {
   using std::swap;
-  swap(ng_, other->ng_);
-  swap(ig_, other->ig_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata OrgChallenge::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OrgChallenge, _impl_.ig_)
+      + sizeof(OrgChallenge::_impl_.ig_)
+      - PROTOBUF_FIELD_OFFSET(OrgChallenge, _impl_.ng_)>(
+          reinterpret_cast<char*>(&_impl_.ng_),
+          reinterpret_cast<char*>(&other->_impl_.ng_));
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// OrgChallenge
-
-// uint64 NG = 1;
-void OrgChallenge::clear_ng() {
-  ng_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 OrgChallenge::ng() const {
-  // @@protoc_insertion_point(field_get:OrgChallenge.NG)
-  return ng_;
-}
-void OrgChallenge::set_ng(::google::protobuf::uint64 value) {
-  
-  ng_ = value;
-  // @@protoc_insertion_point(field_set:OrgChallenge.NG)
-}
-
-// uint32 IG = 2;
-void OrgChallenge::clear_ig() {
-  ig_ = 0u;
-}
-::google::protobuf::uint32 OrgChallenge::ig() const {
-  // @@protoc_insertion_point(field_get:OrgChallenge.IG)
-  return ig_;
+::PROTOBUF_NAMESPACE_ID::Metadata OrgChallenge::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[2]);
 }
-void OrgChallenge::set_ig(::google::protobuf::uint32 value) {
-  
-  ig_ = value;
-  // @@protoc_insertion_point(field_set:OrgChallenge.IG)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DeviceChallenge::kNGFieldNumber;
-const int DeviceChallenge::kNDFieldNumber;
-const int DeviceChallenge::kIDFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DeviceChallenge::_Internal {
+ public:
+};
 
-DeviceChallenge::DeviceChallenge()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:DeviceChallenge)
+DeviceChallenge::DeviceChallenge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:DeviceChallenge)
 }
 DeviceChallenge::DeviceChallenge(const DeviceChallenge& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&ng_, &from.ng_,
-    static_cast<size_t>(reinterpret_cast<char*>(&id_) -
-    reinterpret_cast<char*>(&ng_)) + sizeof(id_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeviceChallenge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ng_){}
+    , decltype(_impl_.nd_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ng_, &from._impl_.ng_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.ng_)) + sizeof(_impl_.id_));
   // @@protoc_insertion_point(copy_constructor:DeviceChallenge)
 }
 
-void DeviceChallenge::SharedCtor() {
-  ::memset(&ng_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&id_) -
-      reinterpret_cast<char*>(&ng_)) + sizeof(id_));
-  _cached_size_ = 0;
+inline void DeviceChallenge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ng_){uint64_t{0u}}
+    , decltype(_impl_.nd_){uint64_t{0u}}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DeviceChallenge::~DeviceChallenge() {
   // @@protoc_insertion_point(destructor:DeviceChallenge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DeviceChallenge::SharedDtor() {
+inline void DeviceChallenge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void DeviceChallenge::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DeviceChallenge::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const DeviceChallenge& DeviceChallenge::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-DeviceChallenge* DeviceChallenge::New(::google::protobuf::Arena* arena) const {
-  DeviceChallenge* n = new DeviceChallenge;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void DeviceChallenge::Clear() {
 // @@protoc_insertion_point(message_clear_start:DeviceChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&ng_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&id_) -
-      reinterpret_cast<char*>(&ng_)) + sizeof(id_));
-  _internal_metadata_.Clear();
-}
-
-bool DeviceChallenge::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:DeviceChallenge)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.ng_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.id_) -
+      reinterpret_cast<char*>(&_impl_.ng_)) + sizeof(_impl_.id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeviceChallenge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint64 NG = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &ng_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ng_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint64 ND = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &nd_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 ID = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:DeviceChallenge)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:DeviceChallenge)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DeviceChallenge::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:DeviceChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint64 NG = 1;
-  if (this->ng() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->ng(), output);
-  }
-
-  // uint64 ND = 2;
-  if (this->nd() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->nd(), output);
-  }
-
-  // uint32 ID = 3;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:DeviceChallenge)
-}
-
-::google::protobuf::uint8* DeviceChallenge::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* DeviceChallenge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:DeviceChallenge)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint64 NG = 1;
-  if (this->ng() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->ng(), target);
+  if (this->_internal_ng() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_ng(), target);
   }
 
   // uint64 ND = 2;
-  if (this->nd() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->nd(), target);
+  if (this->_internal_nd() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_nd(), target);
   }
 
   // uint32 ID = 3;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->id(), target);
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:DeviceChallenge)
   return target;
@@ -1348,77 +1116,53 @@ size_t DeviceChallenge::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:DeviceChallenge)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint64 NG = 1;
-  if (this->ng() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->ng());
+  if (this->_internal_ng() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ng());
   }
 
   // uint64 ND = 2;
-  if (this->nd() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->nd());
+  if (this->_internal_nd() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nd());
   }
 
   // uint32 ID = 3;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->id());
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DeviceChallenge::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:DeviceChallenge)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DeviceChallenge* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const DeviceChallenge>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:DeviceChallenge)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:DeviceChallenge)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeviceChallenge::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeviceChallenge::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeviceChallenge::GetClassData() const { return &_class_data_; }
 
-void DeviceChallenge::MergeFrom(const DeviceChallenge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:DeviceChallenge)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void DeviceChallenge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeviceChallenge*>(&to_msg);
+  auto& from = static_cast<const DeviceChallenge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:DeviceChallenge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.ng() != 0) {
-    set_ng(from.ng());
+  if (from._internal_ng() != 0) {
+    _this->_internal_set_ng(from._internal_ng());
   }
-  if (from.nd() != 0) {
-    set_nd(from.nd());
+  if (from._internal_nd() != 0) {
+    _this->_internal_set_nd(from._internal_nd());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
-}
-
-void DeviceChallenge::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:DeviceChallenge)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DeviceChallenge::CopyFrom(const DeviceChallenge& from) {
@@ -1432,281 +1176,187 @@ bool DeviceChallenge::IsInitialized() const {
   return true;
 }
 
-void DeviceChallenge::Swap(DeviceChallenge* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DeviceChallenge::InternalSwap(DeviceChallenge* other) {
   using std::swap;
-  swap(ng_, other->ng_);
-  swap(nd_, other->nd_);
-  swap(id_, other->id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata DeviceChallenge::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// DeviceChallenge
-
-// uint64 NG = 1;
-void DeviceChallenge::clear_ng() {
-  ng_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 DeviceChallenge::ng() const {
-  // @@protoc_insertion_point(field_get:DeviceChallenge.NG)
-  return ng_;
-}
-void DeviceChallenge::set_ng(::google::protobuf::uint64 value) {
-  
-  ng_ = value;
-  // @@protoc_insertion_point(field_set:DeviceChallenge.NG)
-}
-
-// uint64 ND = 2;
-void DeviceChallenge::clear_nd() {
-  nd_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 DeviceChallenge::nd() const {
-  // @@protoc_insertion_point(field_get:DeviceChallenge.ND)
-  return nd_;
-}
-void DeviceChallenge::set_nd(::google::protobuf::uint64 value) {
-  
-  nd_ = value;
-  // @@protoc_insertion_point(field_set:DeviceChallenge.ND)
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DeviceChallenge, _impl_.id_)
+      + sizeof(DeviceChallenge::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(DeviceChallenge, _impl_.ng_)>(
+          reinterpret_cast<char*>(&_impl_.ng_),
+          reinterpret_cast<char*>(&other->_impl_.ng_));
 }
 
-// uint32 ID = 3;
-void DeviceChallenge::clear_id() {
-  id_ = 0u;
-}
-::google::protobuf::uint32 DeviceChallenge::id() const {
-  // @@protoc_insertion_point(field_get:DeviceChallenge.ID)
-  return id_;
-}
-void DeviceChallenge::set_id(::google::protobuf::uint32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:DeviceChallenge.ID)
+::PROTOBUF_NAMESPACE_ID::Metadata DeviceChallenge::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[3]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int OrgResponse::kNDFieldNumber;
-const int OrgResponse::kIGFieldNumber;
-const int OrgResponse::kHCFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class OrgResponse::_Internal {
+ public:
+};
 
-OrgResponse::OrgResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:OrgResponse)
+OrgResponse::OrgResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:OrgResponse)
 }
 OrgResponse::OrgResponse(const OrgResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  hc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.hc().size() > 0) {
-    hc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hc_);
-  }
-  ::memcpy(&nd_, &from.nd_,
-    static_cast<size_t>(reinterpret_cast<char*>(&ig_) -
-    reinterpret_cast<char*>(&nd_)) + sizeof(ig_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OrgResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hc_){}
+    , decltype(_impl_.nd_){}
+    , decltype(_impl_.ig_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hc().empty()) {
+    _this->_impl_.hc_.Set(from._internal_hc(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.nd_, &from._impl_.nd_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ig_) -
+    reinterpret_cast<char*>(&_impl_.nd_)) + sizeof(_impl_.ig_));
   // @@protoc_insertion_point(copy_constructor:OrgResponse)
 }
 
-void OrgResponse::SharedCtor() {
-  hc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&nd_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ig_) -
-      reinterpret_cast<char*>(&nd_)) + sizeof(ig_));
-  _cached_size_ = 0;
+inline void OrgResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hc_){}
+    , decltype(_impl_.nd_){uint64_t{0u}}
+    , decltype(_impl_.ig_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.hc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 OrgResponse::~OrgResponse() {
   // @@protoc_insertion_point(destructor:OrgResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void OrgResponse::SharedDtor() {
-  hc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void OrgResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hc_.Destroy();
 }
 
 void OrgResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* OrgResponse::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const OrgResponse& OrgResponse::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-OrgResponse* OrgResponse::New(::google::protobuf::Arena* arena) const {
-  OrgResponse* n = new OrgResponse;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void OrgResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:OrgResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  hc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&nd_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ig_) -
-      reinterpret_cast<char*>(&nd_)) + sizeof(ig_));
-  _internal_metadata_.Clear();
-}
-
-bool OrgResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:OrgResponse)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.hc_.ClearToEmpty();
+  ::memset(&_impl_.nd_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ig_) -
+      reinterpret_cast<char*>(&_impl_.nd_)) + sizeof(_impl_.ig_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OrgResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint64 ND = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &nd_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.nd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 IG = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &ig_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.ig_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes HC = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_hc()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_hc();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:OrgResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:OrgResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void OrgResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:OrgResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint64 ND = 1;
-  if (this->nd() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->nd(), output);
-  }
-
-  // uint32 IG = 2;
-  if (this->ig() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->ig(), output);
-  }
-
-  // bytes HC = 3;
-  if (this->hc().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->hc(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:OrgResponse)
-}
-
-::google::protobuf::uint8* OrgResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* OrgResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:OrgResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint64 ND = 1;
-  if (this->nd() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->nd(), target);
+  if (this->_internal_nd() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_nd(), target);
   }
 
   // uint32 IG = 2;
-  if (this->ig() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->ig(), target);
+  if (this->_internal_ig() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ig(), target);
   }
 
   // bytes HC = 3;
-  if (this->hc().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->hc(), target);
+  if (!this->_internal_hc().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_hc(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:OrgResponse)
   return target;
@@ -1716,78 +1366,55 @@ size_t OrgResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:OrgResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes HC = 3;
-  if (this->hc().size() > 0) {
+  if (!this->_internal_hc().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->hc());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hc());
   }
 
   // uint64 ND = 1;
-  if (this->nd() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->nd());
+  if (this->_internal_nd() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_nd());
   }
 
   // uint32 IG = 2;
-  if (this->ig() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->ig());
+  if (this->_internal_ig() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ig());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void OrgResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:OrgResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const OrgResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const OrgResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:OrgResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:OrgResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OrgResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OrgResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OrgResponse::GetClassData() const { return &_class_data_; }
 
-void OrgResponse::MergeFrom(const OrgResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:OrgResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.hc().size() > 0) {
+void OrgResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OrgResponse*>(&to_msg);
+  auto& from = static_cast<const OrgResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:OrgResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    hc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hc_);
+  if (!from._internal_hc().empty()) {
+    _this->_internal_set_hc(from._internal_hc());
   }
-  if (from.nd() != 0) {
-    set_nd(from.nd());
+  if (from._internal_nd() != 0) {
+    _this->_internal_set_nd(from._internal_nd());
   }
-  if (from.ig() != 0) {
-    set_ig(from.ig());
+  if (from._internal_ig() != 0) {
+    _this->_internal_set_ig(from._internal_ig());
   }
-}
-
-void OrgResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:OrgResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void OrgResponse::CopyFrom(const OrgResponse& from) {
@@ -1801,289 +1428,173 @@ bool OrgResponse::IsInitialized() const {
   return true;
 }
 
-void OrgResponse::Swap(OrgResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void OrgResponse::InternalSwap(OrgResponse* other) {
   using std::swap;
-  hc_.Swap(&other->hc_);
-  swap(nd_, other->nd_);
-  swap(ig_, other->ig_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata OrgResponse::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// OrgResponse
-
-// uint64 ND = 1;
-void OrgResponse::clear_nd() {
-  nd_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 OrgResponse::nd() const {
-  // @@protoc_insertion_point(field_get:OrgResponse.ND)
-  return nd_;
-}
-void OrgResponse::set_nd(::google::protobuf::uint64 value) {
-  
-  nd_ = value;
-  // @@protoc_insertion_point(field_set:OrgResponse.ND)
-}
-
-// uint32 IG = 2;
-void OrgResponse::clear_ig() {
-  ig_ = 0u;
-}
-::google::protobuf::uint32 OrgResponse::ig() const {
-  // @@protoc_insertion_point(field_get:OrgResponse.IG)
-  return ig_;
-}
-void OrgResponse::set_ig(::google::protobuf::uint32 value) {
-  
-  ig_ = value;
-  // @@protoc_insertion_point(field_set:OrgResponse.IG)
-}
-
-// bytes HC = 3;
-void OrgResponse::clear_hc() {
-  hc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& OrgResponse::hc() const {
-  // @@protoc_insertion_point(field_get:OrgResponse.HC)
-  return hc_.GetNoArena();
-}
-void OrgResponse::set_hc(const ::std::string& value) {
-  
-  hc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:OrgResponse.HC)
-}
-#if LANG_CXX11
-void OrgResponse::set_hc(::std::string&& value) {
-  
-  hc_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:OrgResponse.HC)
-}
-#endif
-void OrgResponse::set_hc(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  hc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:OrgResponse.HC)
-}
-void OrgResponse::set_hc(const void* value, size_t size) {
-  
-  hc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:OrgResponse.HC)
-}
-::std::string* OrgResponse::mutable_hc() {
-  
-  // @@protoc_insertion_point(field_mutable:OrgResponse.HC)
-  return hc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* OrgResponse::release_hc() {
-  // @@protoc_insertion_point(field_release:OrgResponse.HC)
-  
-  return hc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void OrgResponse::set_allocated_hc(::std::string* hc) {
-  if (hc != NULL) {
-    
-  } else {
-    
-  }
-  hc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hc);
-  // @@protoc_insertion_point(field_set_allocated:OrgResponse.HC)
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hc_, lhs_arena,
+      &other->_impl_.hc_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OrgResponse, _impl_.ig_)
+      + sizeof(OrgResponse::_impl_.ig_)
+      - PROTOBUF_FIELD_OFFSET(OrgResponse, _impl_.nd_)>(
+          reinterpret_cast<char*>(&_impl_.nd_),
+          reinterpret_cast<char*>(&other->_impl_.nd_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OrgResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[4]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int M1::kVFieldNumber;
-const int M1::kOCFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class M1::_Internal {
+ public:
+};
 
-M1::M1()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:M1)
+M1::M1(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:M1)
 }
 M1::M1(const M1& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  oc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.oc().size() > 0) {
-    oc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.oc_);
-  }
-  v_ = from.v_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  M1* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.oc_){}
+    , decltype(_impl_.v_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.oc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.oc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_oc().empty()) {
+    _this->_impl_.oc_.Set(from._internal_oc(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.v_ = from._impl_.v_;
   // @@protoc_insertion_point(copy_constructor:M1)
 }
 
-void M1::SharedCtor() {
-  oc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  v_ = 0u;
-  _cached_size_ = 0;
+inline void M1::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.oc_){}
+    , decltype(_impl_.v_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.oc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.oc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 M1::~M1() {
   // @@protoc_insertion_point(destructor:M1)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void M1::SharedDtor() {
-  oc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void M1::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.oc_.Destroy();
 }
 
 void M1::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* M1::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const M1& M1::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-M1* M1::New(::google::protobuf::Arena* arena) const {
-  M1* n = new M1;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void M1::Clear() {
 // @@protoc_insertion_point(message_clear_start:M1)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  oc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  v_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool M1::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:M1)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.oc_.ClearToEmpty();
+  _impl_.v_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* M1::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 V = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &v_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.v_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bytes OC = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_oc()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_oc();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:M1)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:M1)
-  return false;
-#undef DO_
-}
-
-void M1::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:M1)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 V = 1;
-  if (this->v() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->v(), output);
-  }
-
-  // bytes OC = 2;
-  if (this->oc().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      2, this->oc(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:M1)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* M1::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* M1::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:M1)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 V = 1;
-  if (this->v() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->v(), target);
+  if (this->_internal_v() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_v(), target);
   }
 
   // bytes OC = 2;
-  if (this->oc().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->oc(), target);
+  if (!this->_internal_oc().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_oc(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:M1)
   return target;
@@ -2093,68 +1604,47 @@ size_t M1::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:M1)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes OC = 2;
-  if (this->oc().size() > 0) {
+  if (!this->_internal_oc().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->oc());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_oc());
   }
 
   // uint32 V = 1;
-  if (this->v() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->v());
+  if (this->_internal_v() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_v());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void M1::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:M1)
-  GOOGLE_DCHECK_NE(&from, this);
-  const M1* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const M1>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:M1)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:M1)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData M1::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    M1::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*M1::GetClassData() const { return &_class_data_; }
 
-void M1::MergeFrom(const M1& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:M1)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.oc().size() > 0) {
+void M1::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<M1*>(&to_msg);
+  auto& from = static_cast<const M1&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:M1)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    oc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.oc_);
+  if (!from._internal_oc().empty()) {
+    _this->_internal_set_oc(from._internal_oc());
   }
-  if (from.v() != 0) {
-    set_v(from.v());
+  if (from._internal_v() != 0) {
+    _this->_internal_set_v(from._internal_v());
   }
-}
-
-void M1::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:M1)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void M1::CopyFrom(const M1& from) {
@@ -2168,246 +1658,150 @@ bool M1::IsInitialized() const {
   return true;
 }
 
-void M1::Swap(M1* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void M1::InternalSwap(M1* other) {
   using std::swap;
-  oc_.Swap(&other->oc_);
-  swap(v_, other->v_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata M1::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// M1
-
-// uint32 V = 1;
-void M1::clear_v() {
-  v_ = 0u;
-}
-::google::protobuf::uint32 M1::v() const {
-  // @@protoc_insertion_point(field_get:M1.V)
-  return v_;
-}
-void M1::set_v(::google::protobuf::uint32 value) {
-  
-  v_ = value;
-  // @@protoc_insertion_point(field_set:M1.V)
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.oc_, lhs_arena,
+      &other->_impl_.oc_, rhs_arena
+  );
+  swap(_impl_.v_, other->_impl_.v_);
 }
 
-// bytes OC = 2;
-void M1::clear_oc() {
-  oc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& M1::oc() const {
-  // @@protoc_insertion_point(field_get:M1.OC)
-  return oc_.GetNoArena();
-}
-void M1::set_oc(const ::std::string& value) {
-  
-  oc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:M1.OC)
-}
-#if LANG_CXX11
-void M1::set_oc(::std::string&& value) {
-  
-  oc_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:M1.OC)
-}
-#endif
-void M1::set_oc(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  oc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:M1.OC)
+::PROTOBUF_NAMESPACE_ID::Metadata M1::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[5]);
 }
-void M1::set_oc(const void* value, size_t size) {
-  
-  oc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:M1.OC)
-}
-::std::string* M1::mutable_oc() {
-  
-  // @@protoc_insertion_point(field_mutable:M1.OC)
-  return oc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* M1::release_oc() {
-  // @@protoc_insertion_point(field_release:M1.OC)
-  
-  return oc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void M1::set_allocated_oc(::std::string* oc) {
-  if (oc != NULL) {
-    
-  } else {
-    
-  }
-  oc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), oc);
-  // @@protoc_insertion_point(field_set_allocated:M1.OC)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int M2::kDCFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class M2::_Internal {
+ public:
+};
 
-M2::M2()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:M2)
+M2::M2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:M2)
 }
 M2::M2(const M2& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  dc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.dc().size() > 0) {
-    dc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.dc_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  M2* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dc_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.dc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dc().empty()) {
+    _this->_impl_.dc_.Set(from._internal_dc(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:M2)
 }
 
-void M2::SharedCtor() {
-  dc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void M2::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dc_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.dc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 M2::~M2() {
   // @@protoc_insertion_point(destructor:M2)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void M2::SharedDtor() {
-  dc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void M2::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dc_.Destroy();
 }
 
 void M2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* M2::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const M2& M2::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-M2* M2::New(::google::protobuf::Arena* arena) const {
-  M2* n = new M2;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void M2::Clear() {
 // @@protoc_insertion_point(message_clear_start:M2)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.dc_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool M2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:M2)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* M2::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes DC = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_dc()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_dc();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:M2)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:M2)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void M2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:M2)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bytes DC = 1;
-  if (this->dc().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->dc(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:M2)
-}
-
-::google::protobuf::uint8* M2::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* M2::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:M2)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes DC = 1;
-  if (this->dc().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->dc(), target);
+  if (!this->_internal_dc().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_dc(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:M2)
   return target;
@@ -2417,58 +1811,39 @@ size_t M2::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:M2)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes DC = 1;
-  if (this->dc().size() > 0) {
+  if (!this->_internal_dc().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->dc());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_dc());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void M2::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:M2)
-  GOOGLE_DCHECK_NE(&from, this);
-  const M2* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const M2>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:M2)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:M2)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData M2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    M2::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*M2::GetClassData() const { return &_class_data_; }
 
-void M2::MergeFrom(const M2& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:M2)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.dc().size() > 0) {
+void M2::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<M2*>(&to_msg);
+  auto& from = static_cast<const M2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:M2)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    dc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.dc_);
+  if (!from._internal_dc().empty()) {
+    _this->_internal_set_dc(from._internal_dc());
   }
-}
-
-void M2::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:M2)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void M2::CopyFrom(const M2& from) {
@@ -2482,231 +1857,149 @@ bool M2::IsInitialized() const {
   return true;
 }
 
-void M2::Swap(M2* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void M2::InternalSwap(M2* other) {
   using std::swap;
-  dc_.Swap(&other->dc_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata M2::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dc_, lhs_arena,
+      &other->_impl_.dc_, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// M2
-
-// bytes DC = 1;
-void M2::clear_dc() {
-  dc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& M2::dc() const {
-  // @@protoc_insertion_point(field_get:M2.DC)
-  return dc_.GetNoArena();
-}
-void M2::set_dc(const ::std::string& value) {
-  
-  dc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:M2.DC)
-}
-#if LANG_CXX11
-void M2::set_dc(::std::string&& value) {
-  
-  dc_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:M2.DC)
-}
-#endif
-void M2::set_dc(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  dc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:M2.DC)
+::PROTOBUF_NAMESPACE_ID::Metadata M2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[6]);
 }
-void M2::set_dc(const void* value, size_t size) {
-  
-  dc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:M2.DC)
-}
-::std::string* M2::mutable_dc() {
-  
-  // @@protoc_insertion_point(field_mutable:M2.DC)
-  return dc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* M2::release_dc() {
-  // @@protoc_insertion_point(field_release:M2.DC)
-  
-  return dc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void M2::set_allocated_dc(::std::string* dc) {
-  if (dc != NULL) {
-    
-  } else {
-    
-  }
-  dc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dc);
-  // @@protoc_insertion_point(field_set_allocated:M2.DC)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int M3::kORFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class M3::_Internal {
+ public:
+};
 
-M3::M3()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:M3)
+M3::M3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:M3)
 }
 M3::M3(const M3& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  or__.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.or_().size() > 0) {
-    or__.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.or__);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  M3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.or__){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.or__.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.or__.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_or_().empty()) {
+    _this->_impl_.or__.Set(from._internal_or_(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:M3)
 }
 
-void M3::SharedCtor() {
-  or__.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _cached_size_ = 0;
+inline void M3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.or__){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.or__.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.or__.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 M3::~M3() {
   // @@protoc_insertion_point(destructor:M3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void M3::SharedDtor() {
-  or__.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void M3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.or__.Destroy();
 }
 
 void M3::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* M3::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const M3& M3::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-M3* M3::New(::google::protobuf::Arena* arena) const {
-  M3* n = new M3;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void M3::Clear() {
 // @@protoc_insertion_point(message_clear_start:M3)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  or__.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.or__.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool M3::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:M3)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* M3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bytes OR = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_or_()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_or_();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:M3)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:M3)
-  return false;
-#undef DO_
-}
-
-void M3::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:M3)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bytes OR = 1;
-  if (this->or_().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->or_(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:M3)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* M3::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* M3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:M3)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes OR = 1;
-  if (this->or_().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->or_(), target);
+  if (!this->_internal_or_().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_or_(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:M3)
   return target;
@@ -2716,58 +2009,39 @@ size_t M3::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:M3)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // bytes OR = 1;
-  if (this->or_().size() > 0) {
+  if (!this->_internal_or_().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->or_());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_or_());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void M3::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:M3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const M3* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const M3>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:M3)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:M3)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData M3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    M3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*M3::GetClassData() const { return &_class_data_; }
 
-void M3::MergeFrom(const M3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:M3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.or_().size() > 0) {
+void M3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<M3*>(&to_msg);
+  auto& from = static_cast<const M3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:M3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    or__.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.or__);
+  if (!from._internal_or_().empty()) {
+    _this->_internal_set_or_(from._internal_or_());
   }
-}
-
-void M3::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:M3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void M3::CopyFrom(const M3& from) {
@@ -2781,226 +2055,167 @@ bool M3::IsInitialized() const {
   return true;
 }
 
-void M3::Swap(M3* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void M3::InternalSwap(M3* other) {
   using std::swap;
-  or__.Swap(&other->or__);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata M3::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.or__, lhs_arena,
+      &other->_impl_.or__, rhs_arena
+  );
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// M3
-
-// bytes OR = 1;
-void M3::clear_or_() {
-  or__.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-const ::std::string& M3::or_() const {
-  // @@protoc_insertion_point(field_get:M3.OR)
-  return or__.GetNoArena();
-}
-void M3::set_or_(const ::std::string& value) {
-  
-  or__.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:M3.OR)
-}
-#if LANG_CXX11
-void M3::set_or_(::std::string&& value) {
-  
-  or__.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:M3.OR)
-}
-#endif
-void M3::set_or_(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  or__.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:M3.OR)
+::PROTOBUF_NAMESPACE_ID::Metadata M3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[7]);
 }
-void M3::set_or_(const void* value, size_t size) {
-  
-  or__.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:M3.OR)
-}
-::std::string* M3::mutable_or_() {
-  
-  // @@protoc_insertion_point(field_mutable:M3.OR)
-  return or__.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-::std::string* M3::release_or_() {
-  // @@protoc_insertion_point(field_release:M3.OR)
-  
-  return or__.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-void M3::set_allocated_or_(::std::string* or_) {
-  if (or_ != NULL) {
-    
-  } else {
-    
-  }
-  or__.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), or_);
-  // @@protoc_insertion_point(field_set_allocated:M3.OR)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UpdateImage::kSizeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UpdateImage::_Internal {
+ public:
+};
 
-UpdateImage::UpdateImage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
-    protobuf_protocol_2eproto::InitDefaults();
-  }
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:UpdateImage)
+UpdateImage::UpdateImage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:UpdateImage)
 }
 UpdateImage::UpdateImage(const UpdateImage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      _cached_size_(0) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  size_ = from.size_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateImage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sk_){}
+    , decltype(_impl_.size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.sk_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sk_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sk().empty()) {
+    _this->_impl_.sk_.Set(from._internal_sk(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.size_ = from._impl_.size_;
   // @@protoc_insertion_point(copy_constructor:UpdateImage)
 }
 
-void UpdateImage::SharedCtor() {
-  size_ = 0u;
-  _cached_size_ = 0;
+inline void UpdateImage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sk_){}
+    , decltype(_impl_.size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sk_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sk_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UpdateImage::~UpdateImage() {
   // @@protoc_insertion_point(destructor:UpdateImage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UpdateImage::SharedDtor() {
+inline void UpdateImage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sk_.Destroy();
 }
 
 void UpdateImage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* UpdateImage::descriptor() {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const UpdateImage& UpdateImage::default_instance() {
-  protobuf_protocol_2eproto::InitDefaults();
-  return *internal_default_instance();
-}
-
-UpdateImage* UpdateImage::New(::google::protobuf::Arena* arena) const {
-  UpdateImage* n = new UpdateImage;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void UpdateImage::Clear() {
 // @@protoc_insertion_point(message_clear_start:UpdateImage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  size_ = 0u;
-  _internal_metadata_.Clear();
+  _impl_.sk_.ClearToEmpty();
+  _impl_.size_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool UpdateImage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:UpdateImage)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* UpdateImage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 size = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &size_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // bytes SK = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_sk();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:UpdateImage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:UpdateImage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void UpdateImage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:UpdateImage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* UpdateImage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:UpdateImage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 size = 1;
-  if (this->size() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->size(), output);
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_size(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // bytes SK = 2;
+  if (!this->_internal_sk().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_sk(), target);
   }
-  // @@protoc_insertion_point(serialize_end:UpdateImage)
-}
-
-::google::protobuf::uint8* UpdateImage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:UpdateImage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // uint32 size = 1;
-  if (this->size() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->size(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:UpdateImage)
   return target;
@@ -3010,57 +2225,47 @@ size_t UpdateImage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:UpdateImage)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes SK = 2;
+  if (!this->_internal_sk().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_sk());
   }
+
   // uint32 size = 1;
-  if (this->size() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->size());
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_size());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = cached_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateImage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:UpdateImage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateImage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const UpdateImage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:UpdateImage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:UpdateImage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateImage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateImage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateImage::GetClassData() const { return &_class_data_; }
 
-void UpdateImage::MergeFrom(const UpdateImage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:UpdateImage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void UpdateImage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateImage*>(&to_msg);
+  auto& from = static_cast<const UpdateImage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:UpdateImage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.size() != 0) {
-    set_size(from.size());
+  if (!from._internal_sk().empty()) {
+    _this->_internal_set_sk(from._internal_sk());
   }
-}
-
-void UpdateImage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:UpdateImage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UpdateImage::CopyFrom(const UpdateImage& from) {
@@ -3074,41 +2279,63 @@ bool UpdateImage::IsInitialized() const {
   return true;
 }
 
-void UpdateImage::Swap(UpdateImage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void UpdateImage::InternalSwap(UpdateImage* other) {
   using std::swap;
-  swap(size_, other->size_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(_cached_size_, other->_cached_size_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sk_, lhs_arena,
+      &other->_impl_.sk_, rhs_arena
+  );
+  swap(_impl_.size_, other->_impl_.size_);
 }
 
-::google::protobuf::Metadata UpdateImage::GetMetadata() const {
-  protobuf_protocol_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_protocol_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateImage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[8]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// UpdateImage
-
-// uint32 size = 1;
-void UpdateImage::clear_size() {
-  size_ = 0u;
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::UpdateCheck*
+Arena::CreateMaybeMessage< ::UpdateCheck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::UpdateCheck >(arena);
 }
-::google::protobuf::uint32 UpdateImage::size() const {
-  // @@protoc_insertion_point(field_get:UpdateImage.size)
-  return size_;
+template<> PROTOBUF_NOINLINE ::UpdateStatus*
+Arena::CreateMaybeMessage< ::UpdateStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::UpdateStatus >(arena);
 }
-void UpdateImage::set_size(::google::protobuf::uint32 value) {
-  
-  size_ = value;
-  // @@protoc_insertion_point(field_set:UpdateImage.size)
+template<> PROTOBUF_NOINLINE ::OrgChallenge*
+Arena::CreateMaybeMessage< ::OrgChallenge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::OrgChallenge >(arena);
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
+template<> PROTOBUF_NOINLINE ::DeviceChallenge*
+Arena::CreateMaybeMessage< ::DeviceChallenge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::DeviceChallenge >(arena);
+}
+template<> PROTOBUF_NOINLINE ::OrgResponse*
+Arena::CreateMaybeMessage< ::OrgResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::OrgResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::M1*
+Arena::CreateMaybeMessage< ::M1 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::M1 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::M2*
+Arena::CreateMaybeMessage< ::M2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::M2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::M3*
+Arena::CreateMaybeMessage< ::M3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::M3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::UpdateImage*
+Arena::CreateMaybeMessage< ::UpdateImage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::UpdateImage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
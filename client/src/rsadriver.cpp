@@ -1,38 +1,53 @@
 #include "rsadriver.hpp"
 
-#include <cstdlib>
+#include "csprng.hpp" // for random_bytes()
+
+DriverStats RSADriver::counters ("RSA");
+DriverStats RSADriver::software_counters ("RSA (software)");
+
+std::unique_ptr<Montgomery> RSADriver::public_keys[RSA_KEY_SLOTS];
+
+RSAScheduler& RSADriver::scheduler() {
+    #ifdef AXI_SIMULATION
+        // Loadgen: each thread simulates a separate board with its own core
+        if (sim_board_per_thread) {
+            thread_local RSAScheduler board_scheduler;
+            return board_scheduler;
+        }
+    #endif
+
+    static RSAScheduler core_scheduler;
+    return core_scheduler;
+}
 
 // PKCS#1 1.5 padding: 00 || 02 || 8 bytes of salt || 00
-char PKCS1_PADDING[PKCS1_PAD_SIZE] = {0x00, 0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00};
+const char PKCS1_PADDING[PKCS1_PAD_SIZE] = {0x00, 0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00};
 
-inline void randomize_pkcs1_padding() {
+inline void randomize_pkcs1_padding(char* padding) {
     /**
-     * Randomizes the 8-byte salt in the PKCS#1 padding array.
-     * 
-     * NOTE: This function *assumes* that std::rand() has been properly
-     * seeded elsewhere.
+     * Randomizes the 8-byte salt in the given copy of the PKCS#1 padding.
+     * Salt bytes are non-zero, as PKCS#1 v1.5 requires for the padding string.
      */
-    for (int i = 2; i < 10; i++)
-        PKCS1_PADDING[i] = static_cast<char>(std::rand() & 0xFF);
+    random_bytes(padding + 2, 8);
+
+    for (int i = 2; i < 10; i++) {
+        while (padding[i] == 0)
+            random_bytes(padding + i, 1);
+    }
 }
 
-std::string RSADriver::compute_rsa(const std::string& data, RSAKey key) {
+void RSADriver::compute_rsa(const uint8_t* data, RSAKey key, uint8_t* result) {
     /**
-     * Given a plaintext or ciphertext chunk as string, either encrypts or decrypts
-     * the data using the RSA core under the given key.
+     * Given a plaintext or ciphertext chunk, either encrypts or decrypts the
+     * data using the RSA core under the given key.
      * 
      * Arguments:
      *     - data: single plaintext or ciphertext data in 512 bit chunk
      *     - key: key to be used in core (RSAKey)
-     * 
-     * Returns: std::string consisting of the result (plaintext or ciphertext)
+     *     - result: receives the 512 bit result (plaintext or ciphertext)
      */
-    // Single chunk result of RSA core (enc or dec)
-    std::string result;
-    result.reserve(RSA_CHUNK_SIZE);
-
-    // RSA completion flag
-    uint8_t rsa_done;
+    // Keep other threads off the core until the result is read out
+    RSAScheduler::Grant grant (scheduler(), priority);
 
     // Write the 512-bit chunk to the core
     this->write_chunk(data);
@@ -47,165 +62,217 @@ std::string RSADriver::compute_rsa(const std::string& data, RSAKey key) {
     this->write(RSA_STOP_OFFSET, 0);
 
     // Wait for completion
-    rsa_done = 0;
-    while (rsa_done != 3)
-        rsa_done = this->read(RSA_COMPLETE);
+    this->wait_for(RSA_COMPLETE, 3);
 
     // Read out plaintext chunk in raw binary format (64 bytes)
     read_chunk(result);
 
-    return result;
+    stats.chunks++;
+    stats.bytes_in += RSA_CHUNK_SIZE;
+    stats.bytes_out += RSA_CHUNK_SIZE;
 }
 
-std::string RSADriver::decrypt(const std::string& ciphertext) {
+bool RSADriver::set_public_key(RSAKey key, const std::string& modulus) {
     /**
-     * Given a ciphertext in string format, decrypts it using device key,
-     * and returns the plaintext.
-     * 
-     * Arguments:
-     *     - ciphertext: encrypted data (string)
+     * Sets up the Montgomery context of a public key at startup. The contexts
+     * are read-only afterwards, so they are shared by all threads.
+     */
+    if (key <= 0 || key >= RSA_KEY_SLOTS)
+        return false;
+
+    public_keys[key].reset(new Montgomery(BigNum::from_hex(modulus.c_str())));
+    return true;
+}
+
+const Montgomery* RSADriver::public_key(RSAKey key) {
+    if (key < 0 || key >= RSA_KEY_SLOTS)
+        return NULL;
+
+    return public_keys[key].get();
+}
+
+void RSADriver::encrypt_chunk(const uint8_t* data, RSAKey key, uint8_t* result) {
+    /**
+     * Encrypts a single padded 512 bit chunk under the given public key.
      * 
-     * Returns: plaintext as std::string
+     * Keys whose modulus is set (set_public_key()) are handled by the fixed
+     * exponent path in software (17 Montgomery multiplications), without
+     * waiting for the core. Other key slots go to the core.
      */
-    const int num_chunks = ciphertext.size() / RSA_CHUNK_SIZE;
+    const Montgomery* context = public_key(key);
 
-    // Reserve memory for result of decryption
+    if (context != NULL) {
+        context->modexp_public(BigNum::from_bytes(data, RSA_CHUNK_SIZE)).to_bytes(result);
+
+        software_counters.chunks++;
+        software_counters.bytes_in += RSA_CHUNK_SIZE;
+        software_counters.bytes_out += RSA_CHUNK_SIZE;
+        return;
+    }
+
+    this->compute_rsa(data, key, result);
+}
+
+std::string RSADriver::decrypt(const std::string& ciphertext, bool is_final) {
     std::string plaintext;
+    this->decrypt(ciphertext, plaintext, is_final);
+    return plaintext;
+}
+
+void RSADriver::decrypt(const std::string& ciphertext, std::string& plaintext, bool is_final) {
+    this->decrypt(ciphertext.data(), ciphertext.size(), plaintext, is_final);
+}
+
+void RSADriver::decrypt(const char* ciphertext, size_t size, std::string& plaintext, bool is_final) {
+    /**
+     * Given a ciphertext, decrypts it using device key into
+     * plaintext, replacing its contents but keeping its capacity. Chunks are
+     * processed in fixed buffers, so the only allocation is growing plaintext.
+     * 
+     * Arguments:
+     *     - ciphertext: encrypted data
+     *     - size: size of the encrypted data
+     *     - plaintext: receives the decrypted data
+     *     - is_final: whether the ciphertext ends the message, i.e., its last
+     *                 chunk carries the length padding (false for all but the
+     *                 last part of a message decrypted in parts)
+     */
+    const int num_chunks = size / RSA_CHUNK_SIZE;
+    const uint8_t* chunk = reinterpret_cast<const uint8_t *>(ciphertext);
+
+    plaintext.clear();
     plaintext.reserve(num_chunks * PKCS1_CHUNK_SIZE);
 
-    std::string stripped, decrypted;
+    uint8_t decrypted[RSA_CHUNK_SIZE];
 
     for (int i = 0; i < num_chunks; i++) {
-        // Get substring for current chunk
-        const std::string& chunk = ciphertext.substr(i * RSA_CHUNK_SIZE, RSA_CHUNK_SIZE);
-        
         // Decrypt using RSA core
-        decrypted = this->compute_rsa(chunk, RSAKey::D_PRV);
+        this->compute_rsa(chunk, RSAKey::D_PRV, decrypted);
+        chunk += RSA_CHUNK_SIZE;
 
         // Strip PKCS1 padding and append to final result
-        if (i == num_chunks-1)
-            stripped = this->strip_pkcs1_padding(decrypted, true);
-        else
-            stripped = this->strip_pkcs1_padding(decrypted, false);
-        
-        plaintext.append(stripped);
+        this->strip_pkcs1_padding(decrypted, is_final && i == num_chunks-1, plaintext);
     }
-
-    return plaintext;
 }
 
-std::string RSADriver::strip_pkcs1_padding(const std::string& plaintext, bool is_last) {
+void RSADriver::strip_pkcs1_padding(const uint8_t* decrypted, bool is_last, std::string& plaintext) {
     /**
-     * Given a single plaintext string block, strips all padding from the string and returns original message.
+     * Given a single decrypted chunk, strips all padding from it and appends
+     * the original message to plaintext.
      * 
      * Removes the standard PKCS#1 v1.5 padding as well as the last chunk length padding.
      */
-    // Get a substring with stripped padding (i.e., only chunk data)
-    const std::string chunk = plaintext.substr(PKCS1_PAD_SIZE, PKCS1_CHUNK_SIZE);
+    // Chunk data follows the PKCS#1 padding
+    const uint8_t* chunk = decrypted + PKCS1_PAD_SIZE;
+    const char* data = reinterpret_cast<const char *>(chunk);
 
     // Strip pad_size from start of chunk as well
     if (is_last) {
         // Get pad_size
-        const uint8_t pad_size = (uint8_t)chunk.at(0);
+        const uint8_t pad_size = chunk[0];
 
-        // Padding invalid -> return the chunk as-is
-        if (pad_size >= PKCS1_CHUNK_SIZE)
-            return chunk;
+        // Padding invalid -> append the chunk as-is (a whole chunk of
+        // padding is valid: it ends a message that fills its chunks)
+        if (pad_size > PKCS1_CHUNK_SIZE) {
+            plaintext.append(data, PKCS1_CHUNK_SIZE);
+            return;
+        }
         
         // Check for valid padding
         uint8_t count = 1;
         for (uint8_t i = 1; i < pad_size; i++) {
-            if ((uint8_t)chunk.at(i) == pad_size)
+            if (chunk[i] == pad_size)
                 count++;
         }
         
-        // Padding valid -> strip it out of the chunk and return
+        // Padding valid -> strip it out of the chunk
         if (count == pad_size) {
-            return chunk.substr(pad_size, chunk.size()-pad_size);
+            plaintext.append(data + pad_size, PKCS1_CHUNK_SIZE - pad_size);
+            return;
         }
     }
     
-    // Return chunk by default
-    return chunk;
+    // Append chunk by default
+    plaintext.append(data, PKCS1_CHUNK_SIZE);
+}
+
+std::string RSADriver::encrypt(const std::string& plaintext, RSAKey key, bool is_final) {
+    std::string ciphertext;
+    this->encrypt(plaintext, key, ciphertext, is_final);
+    return ciphertext;
 }
 
-std::string RSADriver::encrypt(const std::string& plaintext, RSAKey key) {
+void RSADriver::encrypt(const std::string& plaintext, RSAKey key, std::string& ciphertext, bool is_final) {
     /**
-     * Given a plaintext in string format, encrypts it using either GU or GC public key.
+     * Given a plaintext in string format, encrypts it using either GU or GC
+     * public key into ciphertext, replacing its contents but keeping its
+     * capacity.
      * 
      * Arguments:
      *     - plaintext: plaintext data (string)
-     * 
-     * Returns: ciphertext as vector<string>
+     *     - key: key slot of the public key
+     *     - ciphertext: receives the encrypted chunks
+     *     - is_final: whether the plaintext ends the message, i.e., gets a
+     *                 last chunk with the length padding
      */
-    int num_chunks = plaintext.size() / PKCS1_CHUNK_SIZE;
+    const int num_chunks = plaintext.size() / PKCS1_CHUNK_SIZE;
     const int last_chunk_size = plaintext.size() % PKCS1_CHUNK_SIZE;
 
-    std::string ciphertext;
-    ciphertext.reserve(num_chunks * RSA_CHUNK_SIZE);
+    ciphertext.clear();
+    ciphertext.reserve((num_chunks + 1) * RSA_CHUNK_SIZE);
 
-    std::string padded, cipher;
-    padded.reserve(RSA_CHUNK_SIZE);
+    // Padded chunk and its encryption
+    uint8_t padded[RSA_CHUNK_SIZE], cipher[RSA_CHUNK_SIZE];
 
-    for (int i = 0; i < num_chunks; i++) {
-        // Get plaintext chunk
-        const std::string& chunk = plaintext.substr(i * PKCS1_CHUNK_SIZE, PKCS1_CHUNK_SIZE);
+    // Per-call copy of the padding, so concurrent encryptions don't share the salt
+    char* padding = reinterpret_cast<char *>(padded);
+    std::memcpy(padding, PKCS1_PADDING, PKCS1_PAD_SIZE);
 
+    for (int i = 0; i < num_chunks; i++) {
         // Add PKCS1 padding to the chunk after randomizing the 8 byte salt
-        randomize_pkcs1_padding();
-        padded.append(PKCS1_PADDING);
+        randomize_pkcs1_padding(padding);
 
         // Add actual data
-        padded.append(chunk);
+        std::memcpy(padded + PKCS1_PAD_SIZE, plaintext.data() + i * PKCS1_CHUNK_SIZE, PKCS1_CHUNK_SIZE);
 
         // Encrypt using RSA
-        cipher = this->compute_rsa(padded, key);
+        this->encrypt_chunk(padded, key, cipher);
 
-        ciphertext.append(cipher);
-
-        padded.clear();
-        cipher.clear();
+        ciphertext.append(reinterpret_cast<const char *>(cipher), RSA_CHUNK_SIZE);
     }
 
-    // Handle the last chunk if it is not exactly the required size
-    if (last_chunk_size != 0) {
-        const std::string& chunk = plaintext.substr(num_chunks * PKCS1_CHUNK_SIZE, last_chunk_size);
+    // Pad the last chunk, or add a chunk of padding only if the plaintext
+    // fills its chunks, so the receiver knows where the message ends
+    if (is_final || last_chunk_size != 0) {
         const int padding_size = PKCS1_CHUNK_SIZE - last_chunk_size;
         
-        // Insert 11 byte PKCS1 v1.5 padding
-        padded.append(PKCS1_PADDING, PKCS1_PAD_SIZE);
+        // Insert 11 byte PKCS1 v1.5 padding with a fresh salt
+        randomize_pkcs1_padding(padding);
         
         // Left pad the plaintext with padding_size until it is 53 bytes long
-        for (int i = 0; i < padding_size; i++)
-            padded.append(1, (char)padding_size);
+        std::memset(padded + PKCS1_PAD_SIZE, padding_size, padding_size);
     
         // Insert actual data to complete the chunk
-        padded.append(chunk);
+        std::memcpy(padded + PKCS1_PAD_SIZE + padding_size, plaintext.data() + num_chunks * PKCS1_CHUNK_SIZE, last_chunk_size);
 
         // Encrypt using RSA
-        cipher = this->compute_rsa(padded, key);
+        this->encrypt_chunk(padded, key, cipher);
 
-        ciphertext.append(cipher);
+        ciphertext.append(reinterpret_cast<const char *>(cipher), RSA_CHUNK_SIZE);
     }
-    
-    return ciphertext;
 }
 
-void RSADriver::write_chunk(const std::string& chunk) {
+void RSADriver::write_chunk(const uint8_t* chunk) {
     /**
      * Given a 512-bit chunk, write it to the correct location to be used
      * by the RSA core for decryption or encryption.
      */
     uint32_t value;
 
-    // Get raw pointer to string data
-    const uint8_t* ptr = reinterpret_cast<const uint8_t *>(chunk.data());
-
     // Iterate over each dword in the chunk
     for (int i = 0; i < RSA_CHUNK_SIZE; i += 4) {
         // Read from pointer into uint32_t
-        std::memcpy(&value, ptr, 4);
-        ptr += 4;
+        std::memcpy(&value, chunk + i, 4);
 
         // Perform little endian byte swap
         const uint32_t swapped = swap_bytes(value);
@@ -216,19 +283,11 @@ void RSADriver::write_chunk(const std::string& chunk) {
     }
 }
 
-void RSADriver::read_chunk(std::string& chunk) {
+void RSADriver::read_chunk(uint8_t* chunk) {
     for (int i = 0; i < RSA_CHUNK_SIZE; i += 4) {
         // Read one dword of the decrypted chunk
         // Start from the last word in the RSA core address space and move down
-        const uint32_t& value = this->read(RSA_DATA_END - i);
-
-        // Split into bytes for adding to string
-        IntSplitter.num = value;
-
-        // Iterate over bytes in reverse order to get correct ordering (little endian :/)
-        for (int j = 3; j >= 0; j--) {
-            const uint8_t& c = IntSplitter.bytes[j];
-            chunk.push_back(c);
-        }
+        const uint32_t value = swap_bytes(this->read(RSA_DATA_END - i));
+        std::memcpy(chunk + i, &value, 4);
     }
 }
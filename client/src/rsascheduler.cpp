@@ -0,0 +1,89 @@
+#include "rsascheduler.hpp"
+
+#include <chrono>
+
+const char* PRIORITY_NAMES[RSA_PRIORITY_CLASSES] = {"interactive", "bulk"};
+
+void RSAScheduler::acquire(RSAPriority priority) {
+    std::unique_lock<std::mutex> guard (lock);
+
+    const uint64_t ticket = next_ticket[priority]++;
+    SchedulerStats& class_stats = stats[priority];
+
+    // Queue depth including this request
+    const uint32_t depth = next_ticket[priority] - next_served[priority];
+
+    if (depth > class_stats.max_depth)
+        class_stats.max_depth = depth;
+
+    auto may_run = [&]() {
+        if (busy || next_served[priority] != ticket)
+            return false;
+
+        // Higher priority classes go first
+        for (int c = 0; c < priority; c++) {
+            if (next_ticket[c] != next_served[c])
+                return false;
+        }
+
+        return true;
+    };
+
+    if (!may_run()) {
+        const auto start = std::chrono::steady_clock::now();
+
+        available.wait(guard, may_run);
+
+        const uint64_t waited = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        class_stats.waits++;
+        class_stats.wait_time += waited;
+
+        if (waited > class_stats.max_wait)
+            class_stats.max_wait = waited;
+    }
+
+    busy = true;
+    next_served[priority]++;
+    class_stats.grants++;
+}
+
+void RSAScheduler::release() {
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        busy = false;
+    }
+
+    // Every waiter checks whether it is next
+    available.notify_all();
+}
+
+uint32_t RSAScheduler::queued(RSAPriority priority) const {
+    std::lock_guard<std::mutex> guard (lock);
+    return next_ticket[priority] - next_served[priority];
+}
+
+SchedulerStats RSAScheduler::get_stats(RSAPriority priority) const {
+    std::lock_guard<std::mutex> guard (lock);
+    return stats[priority];
+}
+
+void RSAScheduler::reset() {
+    std::lock_guard<std::mutex> guard (lock);
+
+    for (SchedulerStats& class_stats: stats)
+        class_stats = SchedulerStats();
+}
+
+void RSAScheduler::print(std::ostream& out) const {
+    std::lock_guard<std::mutex> guard (lock);
+
+    for (int c = 0; c < RSA_PRIORITY_CLASSES; c++) {
+        const SchedulerStats& class_stats = stats[c];
+
+        out << "RSA core " << PRIORITY_NAMES[c] << ": " << class_stats.grants << " chunks, "
+            << class_stats.waits << " waited (" << class_stats.wait_time << " us total, "
+            << class_stats.max_wait << " us max), max queue depth " << class_stats.max_depth << std::endl;
+    }
+}
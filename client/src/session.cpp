@@ -0,0 +1,503 @@
+#include "session.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include <stdexcept>
+
+#ifndef WIRE_CODEC
+    #include "protocol.pb.h" // protobuf message headers
+#endif
+
+#include "wire.hpp" // for WireReader (and the messages with WIRE_CODEC)
+
+#include "rsadriver.hpp"
+#include "policy.hpp"
+#include "aes.hpp"
+#include "trace.hpp"
+#include "csprng.hpp"
+
+using asio::ip::tcp;
+
+void print_binary_string(const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        std::cout << (int)data[i] << " ";
+
+    std::cout << std::endl;
+}
+
+SessionArenaOptions UpdateSession::arena_options(char* block) {
+    SessionArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = SESSION_ARENA_SIZE;
+    return options;
+}
+
+void UpdateSession::send_update_check() {
+    /**
+     * Send update check to server and return new update version.
+     */
+    std::string data;
+
+    UpdateCheck uc;
+    uc.set_v(version);
+    uc.set_id(id);
+    uc.set_hi(installed_hash);
+    uc.SerializeToString(&data);
+
+    socket.send(asio::buffer(data));
+}
+
+size_t parse_update_status(const char* data, size_t size, bool& available, bool& parallel_auth) {
+    /**
+     * Parses a length-delimited UpdateStatus (varint size, then the message)
+     * at the start of data. Returns the bytes it takes up, or 0 if data
+     * doesn't start with a complete and valid one.
+     */
+    WireReader reader (data, size);
+    uint64_t length;
+    UpdateStatus status;
+
+    if (!reader.read_varint(length) || length > size - reader.position(data))
+        return 0;
+
+    const size_t start = reader.position(data);
+
+    if (!status.ParseFromArray(data + start, length))
+        return 0;
+
+    available = status.successful();
+    parallel_auth = status.parallel_auth();
+
+    return start + length;
+}
+
+bool UpdateSession::check_for_update() {
+    /**
+     * Sends the UpdateCheck and handles the server's reply, an UpdateStatus
+     * whose successful field tells whether an update is available, and its
+     * parallel_auth field how the confirming orgs are reached. The reply
+     * is length-delimited because M1 follows right after it in that case;
+     * whatever arrived after the reply is kept for run_protocol().
+     */
+    this->send_update_check();
+
+    const char* data;
+    const size_t size = this->receive_message(data);
+
+    bool available;
+    const size_t status_size = parse_update_status(data, size, available, parallel_auth);
+
+    if (status_size == 0) {
+        print_binary_string(data, size);
+        std::cout << "Error parsing UpdateStatus" << std::endl;
+        return false;
+    }
+
+    if (status_size < size) {
+        pending_data = data + status_size;
+        pending_size = size - status_size;
+    }
+
+    up_to_date = !available;
+
+    return available;
+}
+
+size_t single_field_size(const char* data, size_t size) {
+    /**
+     * Returns the encoded size of a message made of a single length-delimited
+     * field (such as M3) at the start of data, or size if the field header
+     * can't be read.
+     */
+    WireReader reader (data, size);
+    uint32_t field;
+    WireBytes value;
+
+    if (!reader.next(field) || !reader.read(value))
+        return size;
+
+    return reader.position(data);
+}
+
+size_t UpdateSession::receive_message(const char*& data) {
+    // Bytes that arrived with the previous message
+    if (pending_size > 0) {
+        const size_t len = pending_size;
+        data = pending_data;
+        pending_size = 0;
+        return len;
+    }
+
+    if (buf == NULL)
+        buf = SessionArena::CreateArray<char>(&arena, 512);
+
+    data = buf;
+    return socket.receive(asio::buffer(buf, 512));
+}
+
+void UpdateSession::receive_image(uint32_t image_size) {
+    // Open output file for received image
+    std::ofstream out_file;
+
+    if (image_path)
+        out_file.open(image_path, std::ios::binary | std::ios::out);
+
+    // Allocate buffer of 4 KB
+    char* block = SessionArena::CreateArray<char>(&arena, 4096);
+
+    // Bytes read from socket
+    size_t len;
+
+    // Total bytes read
+    uint32_t total_read = 0;
+
+    TraceSpan span ("Image receive");
+    const auto start = std::chrono::steady_clock::now();
+
+    // Keep reading while data available
+    while (total_read < image_size) {
+        len = socket.receive(asio::buffer(block, 4096));
+
+        if (image_path)
+            out_file.write(block, len);
+
+        total_read += len;
+    }
+
+    span.end();
+
+    image_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Done!
+    socket.send(asio::buffer("OK"));
+
+    out_file.close();
+}
+
+bool UpdateSession::run_protocol(Org org, std::string& hash) {
+    return this->run_protocol(org, hash, (org == Org::GU) ? RSAKey::GU_PUB : RSAKey::GC_PUB);
+}
+
+bool UpdateSession::run_protocol(Org org, std::string& hash, RSAKey key) {
+    const bool success = !encrypt ? this->exchange_messages<Plaintext>(org, hash, key)
+                       : broker ? this->exchange_messages<BrokerEncrypted>(org, hash, key)
+                       : this->exchange_messages<Encrypted>(org, hash, key);
+
+    // Free everything the run allocated at once
+    arena.Reset();
+    buf = NULL;
+    pending_size = 0;
+
+    return success;
+}
+
+template <typename Encryption>
+bool UpdateSession::exchange_messages(Org org, std::string& hash, RSAKey key) {
+    bool valid;
+
+    const char* org_name = (org == Org::GU) ? "GU" : "GC";
+
+    const char* data;
+    size_t size;
+
+    // Store incoming M1 in 512 byte receive buffer
+    TraceSpan m1_span ("M1 receive", org_name);
+    size = this->receive_message(data);
+    m1_span.end();
+
+    // Parse M1 using protobuf
+    M1* m1 = SessionArena::CreateMessage<M1>(&arena);
+    valid = m1->ParseFromArray(data, size);
+
+    if (!valid) {
+        print_binary_string(data, size);
+        std::cout << "Error parsing M1 from: " << org << std::endl;
+        return false;
+    }
+
+    if (org == Org::GU)
+        update_version = m1->v();
+
+    Encryption crypto;
+
+    TraceSpan oc_span ("OC decrypt", org_name);
+    crypto.decrypt(m1->oc().data(), m1->oc().size(), plaintext);
+    oc_span.end();
+
+    // Parse OrgChallenge embedded in M1
+    OrgChallenge* oc = SessionArena::CreateMessage<OrgChallenge>(&arena);
+    valid = oc->ParseFromString(plaintext);
+    if (!valid) {
+        print_binary_string(plaintext.data(), plaintext.size());
+        std::cout << std::endl << "Error parsing OrgChallenge from: " << org << std::endl;
+        return false;
+    }
+
+    const uint32_t ng = oc->ng();
+
+    // Construct DeviceChallenge for org
+    DeviceChallenge* dc = SessionArena::CreateMessage<DeviceChallenge>(&arena);
+    dc->set_id(id);
+    dc->set_ng(ng);
+
+    // Generate a random device nonce, N_D
+    const uint32_t nd = random_word();
+    dc->set_nd(nd);
+
+    dc->SerializeToString(&message);
+
+    // Encrypt to the org public key
+    TraceSpan dc_span ("M2 encrypt", org_name);
+    M2* m2 = SessionArena::CreateMessage<M2>(&arena);
+    m2->set_dc(crypto.encrypt(message, key, ciphertext));
+    dc_span.end();
+
+    // Serialize into the arena and send back to org
+    const size_t m2_size = m2->ByteSizeLong();
+    uint8_t* m2_data = SessionArena::CreateArray<uint8_t>(&arena, m2_size);
+    m2->SerializeToArray(m2_data, m2_size);
+
+    socket.send(asio::buffer(m2_data, m2_size));
+
+    // Get final reply from org as M3
+    TraceSpan m3_span ("M3 receive", org_name);
+    size = this->receive_message(data);
+    m3_span.end();
+
+    // G_U sends UpdateImage right after M3, so both may arrive in one receive
+    const size_t m3_size = single_field_size(data, size);
+
+    if (m3_size < size) {
+        pending_data = data + m3_size;
+        pending_size = size - m3_size;
+        size = m3_size;
+    }
+
+    M3* m3 = SessionArena::CreateMessage<M3>(&arena);
+    valid = m3->ParseFromArray(data, size);
+
+    if (!valid) {
+        print_binary_string(data, size);
+        std::cout << "Error parsing M3 from: " << org << std::endl;
+        return false;
+    }
+
+    TraceSpan or_span ("OR decrypt", org_name);
+    crypto.decrypt(m3->or_().data(), m3->or_().size(), plaintext);
+    or_span.end();
+
+    // Parse OrgResponse
+    OrgResponse* ur = SessionArena::CreateMessage<OrgResponse>(&arena);
+    valid = ur->ParseFromString(plaintext);
+
+    if (!valid) {
+        print_binary_string(plaintext.data(), plaintext.size());
+        std::cout << "Error parsing OrgResponse from: " << org << std::endl;
+        return false;
+    }
+
+    // Check nonce sent from org
+    if (ur->nd() != nd) {
+        std::cout << "Organization " << org << " authentication failed!";
+        return false;
+    }
+
+    if (org == Org::GU) {
+        // Get image length
+        size = this->receive_message(data);
+
+        UpdateImage* ui = SessionArena::CreateMessage<UpdateImage>(&arena);
+        ui->ParseFromArray(data, size);
+        image_size = ui->size();
+
+        // Hybrid mode: image is encrypted with AES-CTR under a session key wrapped with D_pub
+        if (Encryption::enabled && ui->sk().size() > 0) {
+            crypto.decrypt(ui->sk().data(), ui->sk().size(), session_key);
+
+            if (session_key.size() != AES_SESSION_KEY_SIZE) {
+                std::cout << "Invalid session key from: " << org << std::endl;
+                return false;
+            }
+        } else {
+            session_key.clear();
+        }
+
+        // Hold the download until it is known to be wanted
+        if (confirm_image && !confirm_image())
+            return false;
+
+        // Tell server to start sending the update image
+        socket.send(asio::buffer("OK"));
+
+        // Receive the update image and write to image_path on disk
+        this->receive_image(image_size);
+    }
+
+    else if (org == Org::GC) {
+        // Retrieve hash from the org
+        hash.assign(ur->hc().data(), ur->hc().size());
+    }
+
+    return true;
+}
+
+std::vector<ConfirmingOrg> default_confirming_orgs(const tcp::endpoint& gu_endpoint, uint32_t num_orgs) {
+    std::vector<ConfirmingOrg> orgs;
+
+    for (uint32_t i = 0; i < num_orgs; i++) {
+        ConfirmingOrg org;
+        org.endpoint = tcp::endpoint(gu_endpoint.address(), gu_endpoint.port() + 1 + i);
+        org.key = RSAKey::GC_PUB;
+        orgs.push_back(org);
+    }
+
+    return orgs;
+}
+
+uint32_t count_matching(const std::vector<std::string>& hashes, std::string& hash) {
+    std::map<std::string, uint32_t> counts;
+    uint32_t max_count = 0;
+
+    for (const std::string& h: hashes) {
+        const uint32_t count = ++counts[h];
+
+        if (count > max_count) {
+            max_count = count;
+            hash = h;
+        }
+    }
+
+    return max_count;
+}
+
+void ConfirmingOrgs::start(const std::vector<ConfirmingOrg>& orgs) {
+    /**
+     * Starts a thread per confirming org that connects to its endpoint, sends
+     * the UpdateCheck and runs the G_C protocol.
+     */
+    states.assign(orgs.size(), RUNNING);
+    org_hashes.assign(orgs.size(), std::string());
+    sockets.assign(orgs.size(), NULL);
+
+    for (size_t i = 0; i < orgs.size(); i++)
+        threads.push_back(std::thread(&ConfirmingOrgs::run_org, this, i, orgs[i]));
+}
+
+void ConfirmingOrgs::run_org(size_t i, const ConfirmingOrg& org) {
+    OrgState state = FAILED;
+    std::string hash;
+
+    asio::io_service io_service;
+    tcp::socket socket (io_service);
+
+    // Register the socket so cancel() can interrupt blocking receives
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        sockets[i] = &socket;
+    }
+
+    try {
+        socket.connect(org.endpoint);
+
+        // Cancelled while connecting (shutdown has no effect before the connection exists)
+        {
+            std::lock_guard<std::mutex> guard (lock);
+
+            if (cancelled)
+                throw std::runtime_error("cancelled");
+        }
+
+        UpdateSession session (socket, id, version);
+        session.encrypt = encrypt;
+        session.broker = broker;
+
+        TraceSpan span ("Protocol", "GC");
+
+        if (!session.check_for_update())
+            state = session.up_to_date ? UP_TO_DATE : FAILED;
+        else if (session.run_protocol(Org::GC, hash, org.key))
+            state = SUCCEEDED;
+    } catch (std::exception& e) {
+        std::lock_guard<std::mutex> guard (lock);
+
+        if (!cancelled)
+            std::cout << "Confirming org at " << org.endpoint << " failed: " << e.what() << std::endl;
+    }
+
+    std::lock_guard<std::mutex> guard (lock);
+    sockets[i] = NULL;
+    states[i] = state;
+    org_hashes[i] = hash;
+    finished.notify_all();
+}
+
+bool ConfirmingOrgs::wait_for_quorum(uint32_t quorum, std::vector<std::string>& hashes) {
+    /**
+     * Waits for the confirming orgs until a quorum of them returned the same
+     * hash, or until too few are left running to reach the quorum. Orgs still
+     * running at that point are cancelled.
+     */
+    std::unique_lock<std::mutex> guard (lock);
+    bool success = false;
+
+    hashes.clear();
+
+    while (true) {
+        std::vector<std::string> confirmed;
+        uint32_t running = 0;
+
+        for (size_t i = 0; i < states.size(); i++) {
+            if (states[i] == SUCCEEDED)
+                confirmed.push_back(org_hashes[i]);
+            else if (states[i] == RUNNING)
+                running++;
+            else if (states[i] == UP_TO_DATE)
+                up_to_date = true;
+        }
+
+        std::string hash;
+        const uint32_t matching = count_matching(confirmed, hash);
+
+        if (matching >= quorum) {
+            hashes.assign(quorum, hash);
+            success = true;
+            break;
+        }
+
+        // Even if all remaining orgs agree with the largest group, no quorum
+        if (matching + running < quorum)
+            break;
+
+        finished.wait(guard);
+    }
+
+    guard.unlock();
+    this->cancel();
+
+    return success;
+}
+
+void ConfirmingOrgs::cancel() {
+    std::lock_guard<std::mutex> guard (lock);
+    cancelled = true;
+
+    // Wake up orgs blocked on the network; they end with an error that is not reported
+    for (tcp::socket* socket: sockets) {
+        asio::error_code error;
+
+        if (socket)
+            socket->shutdown(tcp::socket::shutdown_both, error);
+    }
+}
+
+ConfirmingOrgs::~ConfirmingOrgs() {
+    this->cancel();
+
+    for (std::thread& thread: threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
@@ -2,49 +2,98 @@
 
 #include <cstring>
 
+DriverStats SHA3Driver::counters ("SHA3");
+
+std::mutex& SHA3Driver::core_lock() {
+    #ifdef AXI_SIMULATION
+        // Loadgen: each thread simulates a separate board with its own core
+        if (sim_board_per_thread) {
+            thread_local std::mutex board_lock;
+            return board_lock;
+        }
+    #endif
+
+    static std::mutex lock;
+    return lock;
+}
+
 void SHA3Driver::reset() {
     this->write(SHA3_RESET_OFFSET, 0x0);
 }
 
 std::string SHA3Driver::compute_hash(std::string& input, bool readable) {
+    this->begin();
+    this->update(input.data(), input.size());
+    return this->finalize(readable);
+}
+
+void SHA3Driver::begin() {
+    // Wait until no other driver has a hash in progress
+    if (!core.owns_lock())
+        core = std::unique_lock<std::mutex>(core_lock());
+
     // Reset the core
     this->reset();
 
-    // If input not multiple of 64 bytes, append 0xFFs to the end
-    const uint8_t last_block_size = input.size() % 64;
+    tail_size = 0;
+    total_size = 0;
+}
 
-    if (last_block_size != 0)
-        input.append(HASH_SIZE - last_block_size, 0xFF);
+void SHA3Driver::update(const char* data, size_t length) {
+    /**
+     * Writes the given data to the SHA-3 FIFO. Data does not need to be
+     * word aligned: leftover bytes are kept until the next update() or finalize().
+     */
+    const uint8_t* ptr = reinterpret_cast<const uint8_t *>(data);
+    total_size += length;
 
-    // Get a pointer to underlying string data
-    const uint8_t* ptr = reinterpret_cast<const uint8_t *>(input.data());
+    // Complete a partially filled word first
+    while (tail_size != 0 && length > 0) {
+        tail[tail_size++] = *ptr++;
+        length--;
 
-    // Number of 32-bit words in the input
-    const size_t num_words = input.size() / 4;
-    
-    uint32_t value;
+        if (tail_size == 4) {
+            this->write_words(tail, 1);
+            tail_size = 0;
+        }
+    }
 
-    // Write each dword to the SHA-3 FIFO address
-    for (uint32_t i = 0; i < num_words; i++) {
-        // Read int from uint8_t *
-        std::memcpy(&value, ptr, 4);
-        ptr += 4;
+    // Write all complete words directly from the input
+    const size_t num_words = length / 4;
+    this->write_words(ptr, num_words);
+    ptr += num_words * 4;
+    length -= num_words * 4;
 
-    	// Perform a byte swap to account for reading int in little endian form
-    	const uint32_t swapped = swap_bytes(value);
-        this->write(MSG_DATA_OFFSET, swapped);
+    // Keep the remaining bytes for later
+    std::memcpy(tail, ptr, length);
+    tail_size += length;
+}
+
+std::string SHA3Driver::finalize(bool readable) {
+    // If input not multiple of 64 bytes, append 0xFFs to the end
+    const uint8_t last_block_size = total_size % 64;
+
+    if (last_block_size != 0) {
+        const std::string padding (HASH_SIZE - last_block_size, 0xFF);
+        this->update(padding.data(), padding.size());
     }
 
     // Start hash computation
     this->write(START_HASH_OFFSET, 0x0);
 
     // Wait for ready bit
-    uint8_t hash_ready = 0;
-    while (hash_ready != 1)
-        hash_ready = this->read(HASH_READY_OFFSET);
+    this->wait_for(HASH_READY_OFFSET, 1);
 
     // Read out the resulting hash
     std::string hash = this->read_hash();
+
+    stats.chunks += total_size / INPUT_SIZE;
+    stats.bytes_in += total_size;
+    stats.bytes_out += HASH_SIZE;
+
+    // Let other drivers use the core
+    if (core.owns_lock())
+        core.unlock();
     
     // If readable: return a hex string of the hash
     if (readable)
@@ -53,6 +102,21 @@ std::string SHA3Driver::compute_hash(std::string& input, bool readable) {
         return hash;
 }
 
+void SHA3Driver::write_words(const uint8_t* ptr, size_t num_words) {
+    uint32_t value;
+
+    // Write each dword to the SHA-3 FIFO address
+    for (size_t i = 0; i < num_words; i++) {
+        // Read int from uint8_t *
+        std::memcpy(&value, ptr, 4);
+        ptr += 4;
+
+    	// Perform a byte swap to account for reading int in little endian form
+    	const uint32_t swapped = swap_bytes(value);
+        this->write(MSG_DATA_OFFSET, swapped);
+    }
+}
+
 std::string SHA3Driver::read_hash() {
     /**
      * Reads hash returned by SHA-3 core from mapped memory in binary format.
@@ -64,19 +128,9 @@ std::string SHA3Driver::read_hash() {
     std::string hash;
     hash.reserve(HASH_SIZE);
 
-    for (int i = 0; i < HASH_SIZE / 4; i++) {
-        const uint32_t value = this->read(HASH_DATA_OFFSET);
-
-        // Split into bytes for string
-        IntSplitter.num = value;
-
-        // Iterate over bytes in reverse order to get correct hash ordering
-        for (int j = 3; j >= 0; j--) {
-            // Convert each byte to a single character and append to hash string
-            const uint8_t& c = IntSplitter.bytes[j];
-            hash.append(1, c);
-        }
-    }
+    // Successive reads return the hash words in order
+    for (int i = 0; i < HASH_SIZE / 4; i++)
+        append_word(hash, this->read(HASH_DATA_OFFSET));
 
     return hash;
 }
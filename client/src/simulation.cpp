@@ -0,0 +1,265 @@
+#ifdef AXI_SIMULATION
+
+#include "simulation.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstring>
+
+#include "axidriver.hpp" // for DEVICE_MEM_SPACE
+#include "rsadriver.hpp" // for RSA core register offsets
+#include "sha3driver.hpp" // for SHA-3 core register offsets
+#include "bignum.hpp"
+#include "rsakeys.hpp"
+
+// Keccak-f[1600] round constants
+static const uint64_t KECCAK_RC[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+// Rotation offsets and lane order of the combined rho and pi steps
+static const int KECCAK_ROTC[24] = {
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+};
+
+static const int KECCAK_PILN[24] = {
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+};
+
+// Keccak-512 rate (in bytes)
+#define KECCAK_RATE 72
+
+static inline uint64_t rotl64(uint64_t x, int n) {
+    return (x << n) | (x >> (64 - n));
+}
+
+static void keccak_f(uint64_t state[25]) {
+    uint64_t c[5];
+
+    for (int round = 0; round < 24; round++) {
+        // Theta
+        for (int i = 0; i < 5; i++)
+            c[i] = state[i] ^ state[i + 5] ^ state[i + 10] ^ state[i + 15] ^ state[i + 20];
+
+        for (int i = 0; i < 5; i++) {
+            const uint64_t t = c[(i + 4) % 5] ^ rotl64(c[(i + 1) % 5], 1);
+            for (int j = 0; j < 25; j += 5)
+                state[j + i] ^= t;
+        }
+
+        // Rho and pi
+        uint64_t t = state[1];
+        for (int i = 0; i < 24; i++) {
+            const int j = KECCAK_PILN[i];
+            const uint64_t next = state[j];
+            state[j] = rotl64(t, KECCAK_ROTC[i]);
+            t = next;
+        }
+
+        // Chi
+        for (int j = 0; j < 25; j += 5) {
+            for (int i = 0; i < 5; i++)
+                c[i] = state[j + i];
+            for (int i = 0; i < 5; i++)
+                state[j + i] ^= (~c[(i + 1) % 5]) & c[(i + 2) % 5];
+        }
+
+        // Iota
+        state[0] ^= KECCAK_RC[round];
+    }
+}
+
+// Plain memory, for devices without a model (e.g. the device DNA reader)
+class SimMemory : public SimDevice {
+public:
+    SimMemory() : mem(DEVICE_MEM_SPACE, 0) {}
+
+    uint32_t read(uint32_t offset) {
+        uint32_t value = 0;
+        if (offset + 4 <= mem.size())
+            std::memcpy(&value, &mem[offset], 4);
+        return value;
+    }
+
+    void write(uint32_t offset, uint32_t value) {
+        if (offset + 4 <= mem.size())
+            std::memcpy(&mem[offset], &value, 4);
+    }
+private:
+    std::vector<uint8_t> mem;
+};
+
+// RSA-512 core: 16 data registers (least significant word at RSA_DATA_START),
+// key select/completion register and start/stop registers
+class SimRSACore : public SimDevice {
+public:
+    uint32_t read(uint32_t offset) {
+        if (offset == RSA_COMPLETE)
+            return status;
+        if (offset <= RSA_DATA_END)
+            return data.limbs[offset / 4];
+        return 0;
+    }
+
+    void write(uint32_t offset, uint32_t value) {
+        if (offset <= RSA_DATA_END)
+            data.limbs[offset / 4] = value;
+        else if (offset == RSA_KEY_SELECT)
+            key = value;
+        else if (offset == RSA_START_OFFSET && value != 0)
+            this->compute();
+    }
+private:
+    BigNum data = {};
+    uint32_t key = 0;
+    uint32_t status = 0;
+
+    // Montgomery contexts and exponents per key slot, created on first use
+    std::unique_ptr<Montgomery> contexts[RSA_KEY_SLOTS];
+    BigNum exponents[RSA_KEY_SLOTS];
+
+    void compute() {
+        // Unknown key slots produce zeroes
+        if (key == 0 || key >= RSA_KEY_SLOTS) {
+            data = BigNum();
+            status = 3;
+            return;
+        }
+
+        if (!contexts[key]) {
+            contexts[key].reset(new Montgomery(BigNum::from_hex(RSA_KEY_TABLE[key].modulus)));
+            exponents[key] = BigNum::from_hex(RSA_KEY_TABLE[key].exponent);
+        }
+
+        data = contexts[key]->modexp(data, exponents[key]);
+        status = 3;
+    }
+};
+
+// SHA-3 core: computes Keccak-512 over all words written to the FIFO since reset
+class SimSHA3Core : public SimDevice {
+public:
+    SimSHA3Core() {
+        this->reset();
+    }
+
+    uint32_t read(uint32_t offset) {
+        if (offset == HASH_READY_OFFSET)
+            return ready;
+
+        if (offset == HASH_DATA_OFFSET) {
+            // Successive reads return the hash words, most significant byte first
+            const uint8_t* word = &hash[4 * (hash_index++ % (HASH_SIZE / 4))];
+            return ((uint32_t)word[0] << 24) | ((uint32_t)word[1] << 16) | ((uint32_t)word[2] << 8) | word[3];
+        }
+
+        return 0;
+    }
+
+    void write(uint32_t offset, uint32_t value) {
+        if (offset == SHA3_RESET_OFFSET) {
+            this->reset();
+        } else if (offset == MSG_DATA_OFFSET) {
+            // Words are written most significant byte first
+            for (int i = 3; i >= 0; i--)
+                this->absorb((uint8_t)(value >> (8 * i)));
+        } else if (offset == START_HASH_OFFSET) {
+            this->finalize();
+        }
+    }
+private:
+    uint64_t state[25];
+    uint8_t block[KECCAK_RATE];
+    size_t block_size;
+
+    uint8_t hash[HASH_SIZE];
+    uint32_t hash_index;
+    uint32_t ready;
+
+    void reset() {
+        std::memset(state, 0, sizeof(state));
+        block_size = 0;
+        hash_index = 0;
+        ready = 0;
+    }
+
+    void absorb(uint8_t byte) {
+        block[block_size++] = byte;
+
+        if (block_size == KECCAK_RATE) {
+            this->absorb_block();
+            block_size = 0;
+        }
+    }
+
+    void absorb_block() {
+        for (int i = 0; i < KECCAK_RATE / 8; i++) {
+            uint64_t lane = 0;
+            for (int j = 0; j < 8; j++)
+                lane |= (uint64_t)block[8 * i + j] << (8 * j);
+            state[i] ^= lane;
+        }
+
+        keccak_f(state);
+    }
+
+    void finalize() {
+        // Original Keccak padding (0x01 ... 0x80), not the FIPS 202 SHA-3 one
+        std::memset(block + block_size, 0, KECCAK_RATE - block_size);
+        block[block_size] ^= 0x01;
+        block[KECCAK_RATE - 1] ^= 0x80;
+        this->absorb_block();
+
+        for (int i = 0; i < HASH_SIZE; i++)
+            hash[i] = (uint8_t)(state[i / 8] >> (8 * (i % 8)));
+
+        hash_index = 0;
+        ready = 1;
+    }
+};
+
+bool sim_board_per_thread = false;
+
+typedef std::map<uint32_t, std::unique_ptr<SimDevice>> SimBoard;
+
+static SimDevice* board_device(SimBoard& devices, uint32_t base_address) {
+    std::unique_ptr<SimDevice>& device = devices[base_address];
+
+    if (!device) {
+        if (base_address == RSA_BASE_ADDR)
+            device.reset(new SimRSACore());
+        else if (base_address == SHA3_BASE_ADDR)
+            device.reset(new SimSHA3Core());
+        else
+            device.reset(new SimMemory());
+    }
+
+    return device.get();
+}
+
+SimDevice* sim_device(uint32_t base_address) {
+    /**
+     * Register accesses to the shared devices need no lock here: like the
+     * real cores, they are serialized by the drivers (the RSA scheduler and
+     * the SHA-3 core lock). Only creating a device is.
+     */
+    if (sim_board_per_thread) {
+        thread_local SimBoard devices;
+        return board_device(devices, base_address);
+    }
+
+    static SimBoard devices;
+    static std::mutex lock;
+
+    std::lock_guard<std::mutex> guard (lock);
+    return board_device(devices, base_address);
+}
+
+#endif
@@ -0,0 +1,61 @@
+#include "trace.hpp"
+
+#include <cstdio>
+
+// Assigns small, stable IDs to threads for the trace viewer
+static uint32_t thread_id() {
+    static std::atomic<uint32_t> next_tid {1};
+    thread_local uint32_t tid = next_tid++;
+    return tid;
+}
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+uint64_t Tracer::now() const {
+    const auto elapsed = std::chrono::steady_clock::now() - epoch;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void Tracer::record(const char* name, const char* category, uint64_t start, uint64_t end) {
+    // Claim the next slot, overwriting the oldest span once the buffer is full
+    const uint64_t index = next.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent& event = events[index % TRACE_BUFFER_SIZE];
+
+    event.name = name;
+    event.category = category;
+    event.start = start;
+    event.duration = end - start;
+    event.tid = thread_id();
+}
+
+bool Tracer::dump(const char* path) const {
+    FILE* out = std::fopen(path, "w");
+
+    if (out == NULL) {
+        std::perror(path);
+        return false;
+    }
+
+    const uint64_t total = next.load();
+    const uint64_t count = total < TRACE_BUFFER_SIZE ? total : TRACE_BUFFER_SIZE;
+
+    std::fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    // Oldest span first
+    for (uint64_t i = total - count; i < total; i++) {
+        const TraceEvent& event = events[i % TRACE_BUFFER_SIZE];
+
+        std::fprintf(out, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                          "\"ts\":%llu,\"dur\":%llu}\n",
+                     i == total - count ? "" : ",", event.name, event.category ? event.category : "",
+                     event.tid, (unsigned long long)event.start, (unsigned long long)event.duration);
+    }
+
+    std::fprintf(out, "]}\n");
+    std::fclose(out);
+
+    return true;
+}
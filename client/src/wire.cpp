@@ -0,0 +1,521 @@
+#include "wire.hpp"
+
+bool WireReader::read_varint(uint64_t& value) {
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos == end)
+            break;
+
+        const uint8_t byte = *pos++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    // Truncated or longer than 10 bytes
+    error = true;
+    return false;
+}
+
+bool WireReader::next(uint32_t& field) {
+    if (error || pos == end)
+        return false;
+
+    uint64_t tag;
+
+    if (!this->read_varint(tag))
+        return false;
+
+    field = tag >> 3;
+    type = tag & 7;
+
+    // Field 0 is invalid
+    if (field == 0 || tag > UINT32_MAX) {
+        error = true;
+        return false;
+    }
+
+    return true;
+}
+
+bool WireReader::read(uint64_t& value) {
+    if (type != WIRE_VARINT) {
+        error = true;
+        return false;
+    }
+
+    return this->read_varint(value);
+}
+
+bool WireReader::read(uint32_t& value) {
+    uint64_t wide;
+
+    if (!this->read(wide))
+        return false;
+
+    // Like protobuf, keep the low 32 bits
+    value = (uint32_t)wide;
+    return true;
+}
+
+bool WireReader::read(bool& value) {
+    uint64_t wide;
+
+    if (!this->read(wide))
+        return false;
+
+    value = wide != 0;
+    return true;
+}
+
+bool WireReader::read(WireBytes& value) {
+    uint64_t length;
+
+    if (type != WIRE_LENGTH_DELIMITED || !this->read_varint(length) || length > (uint64_t)(end - pos)) {
+        error = true;
+        return false;
+    }
+
+    value.ptr = reinterpret_cast<const char *>(pos);
+    value.length = length;
+    pos += length;
+    return true;
+}
+
+bool WireReader::skip() {
+    uint64_t value;
+    WireBytes bytes;
+
+    switch (type) {
+        case WIRE_VARINT:
+            return this->read_varint(value);
+        case WIRE_LENGTH_DELIMITED:
+            return this->read(bytes);
+        case WIRE_FIXED64:
+        case WIRE_FIXED32: {
+            const size_t size = (type == WIRE_FIXED64) ? 8 : 4;
+
+            if ((size_t)(end - pos) < size)
+                break;
+
+            pos += size;
+            return true;
+        }
+    }
+
+    // Groups are not used by proto3
+    error = true;
+    return false;
+}
+
+static size_t varint_size(uint64_t value) {
+    size_t size = 1;
+
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+
+    return size;
+}
+
+void WireWriter::write_varint(uint64_t value) {
+    while (value >= 0x80) {
+        *pos++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+
+    *pos++ = (uint8_t)value;
+}
+
+void WireWriter::write(uint32_t field, uint64_t value) {
+    if (value == 0)
+        return;
+
+    this->write_varint(field << 3 | WIRE_VARINT);
+    this->write_varint(value);
+}
+
+void WireWriter::write(uint32_t field, const WireBytes& value) {
+    if (value.empty())
+        return;
+
+    this->write_varint(field << 3 | WIRE_LENGTH_DELIMITED);
+    this->write_varint(value.size());
+
+    for (size_t i = 0; i < value.size(); i++)
+        *pos++ = (uint8_t)value.data()[i];
+}
+
+size_t wire_size(uint32_t field, uint64_t value) {
+    return (value == 0) ? 0 : varint_size(field << 3) + varint_size(value);
+}
+
+size_t wire_size(uint32_t field, const WireBytes& value) {
+    return value.empty() ? 0 : varint_size(field << 3) + varint_size(value.size()) + value.size();
+}
+
+void* WireArena::allocate(size_t size, size_t alignment) {
+    const size_t offset = (used + alignment - 1) & ~(alignment - 1);
+
+    if (offset + size <= block_size) {
+        used = offset + size;
+        return block + offset;
+    }
+
+    // new[] returns memory aligned for any fundamental type
+    overflow.push_back(std::unique_ptr<char[]>(new char[size]));
+    return overflow.back().get();
+}
+
+void WireArena::Reset() {
+    used = 0;
+    overflow.clear();
+}
+
+#ifdef WIRE_CODEC
+
+template <typename T>
+static bool serialize_to_string(const T& message, std::string* output) {
+    output->resize(message.ByteSizeLong());
+    return message.SerializeToArray(&(*output)[0], output->size());
+}
+
+// UpdateCheck
+
+size_t UpdateCheck::ByteSizeLong() const {
+    return wire_size(1, v_) + wire_size(2, id_) + wire_size(3, hi_);
+}
+
+bool UpdateCheck::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(v_)
+                         : (field == 2) ? reader.read(id_)
+                         : (field == 3) ? reader.read(hi_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool UpdateCheck::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, v_);
+    writer.write(2, id_);
+    writer.write(3, hi_);
+    return true;
+}
+
+bool UpdateCheck::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// UpdateStatus
+
+size_t UpdateStatus::ByteSizeLong() const {
+    return wire_size(1, successful_) + wire_size(2, parallel_auth_);
+}
+
+bool UpdateStatus::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(successful_)
+                         : (field == 2) ? reader.read(parallel_auth_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool UpdateStatus::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, successful_);
+    writer.write(2, parallel_auth_);
+    return true;
+}
+
+bool UpdateStatus::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// OrgChallenge
+
+size_t OrgChallenge::ByteSizeLong() const {
+    return wire_size(1, ng_) + wire_size(2, ig_);
+}
+
+bool OrgChallenge::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(ng_)
+                         : (field == 2) ? reader.read(ig_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool OrgChallenge::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, ng_);
+    writer.write(2, ig_);
+    return true;
+}
+
+bool OrgChallenge::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// DeviceChallenge
+
+size_t DeviceChallenge::ByteSizeLong() const {
+    return wire_size(1, ng_) + wire_size(2, nd_) + wire_size(3, id_);
+}
+
+bool DeviceChallenge::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(ng_)
+                         : (field == 2) ? reader.read(nd_)
+                         : (field == 3) ? reader.read(id_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool DeviceChallenge::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, ng_);
+    writer.write(2, nd_);
+    writer.write(3, id_);
+    return true;
+}
+
+bool DeviceChallenge::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// OrgResponse
+
+size_t OrgResponse::ByteSizeLong() const {
+    return wire_size(1, nd_) + wire_size(2, ig_) + wire_size(3, hc_);
+}
+
+bool OrgResponse::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(nd_)
+                         : (field == 2) ? reader.read(ig_)
+                         : (field == 3) ? reader.read(hc_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool OrgResponse::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, nd_);
+    writer.write(2, ig_);
+    writer.write(3, hc_);
+    return true;
+}
+
+bool OrgResponse::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// M1
+
+size_t M1::ByteSizeLong() const {
+    return wire_size(1, v_) + wire_size(2, oc_);
+}
+
+bool M1::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(v_)
+                         : (field == 2) ? reader.read(oc_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool M1::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, v_);
+    writer.write(2, oc_);
+    return true;
+}
+
+bool M1::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// M2
+
+size_t M2::ByteSizeLong() const {
+    return wire_size(1, dc_);
+}
+
+bool M2::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(dc_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool M2::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, dc_);
+    return true;
+}
+
+bool M2::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// M3
+
+size_t M3::ByteSizeLong() const {
+    return wire_size(1, or_bytes_);
+}
+
+bool M3::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(or_bytes_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool M3::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, or_bytes_);
+    return true;
+}
+
+bool M3::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+// UpdateImage
+
+size_t UpdateImage::ByteSizeLong() const {
+    return wire_size(1, size_) + wire_size(2, sk_);
+}
+
+bool UpdateImage::ParseFromArray(const void* data, int size) {
+    WireReader reader (data, size);
+    uint32_t field;
+
+    this->Clear();
+
+    while (reader.next(field)) {
+        const bool valid = (field == 1) ? reader.read(size_)
+                         : (field == 2) ? reader.read(sk_)
+                         : reader.skip();
+        if (!valid)
+            return false;
+    }
+
+    return reader.done();
+}
+
+bool UpdateImage::SerializeToArray(void* data, int size) const {
+    if ((size_t)size < this->ByteSizeLong())
+        return false;
+
+    WireWriter writer (data);
+    writer.write(1, size_);
+    writer.write(2, sk_);
+    return true;
+}
+
+bool UpdateImage::SerializeToString(std::string* output) const {
+    return serialize_to_string(*this, output);
+}
+
+#endif
@@ -0,0 +1,200 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+
+#include "session.hpp"
+
+using asio::ip::tcp;
+
+// Simulated devices get consecutive IDs starting here
+#define FIRST_DEVICE_ID 10000000
+
+#define DEFAULT_DEVICES     1000
+#define DEFAULT_CONCURRENCY 100
+#define DEFAULT_VERSIONS    1
+
+// Confirming orgs per device (endpoints at the G_U port + 1, + 2, ...), all of which must agree by default
+#define DEFAULT_CONFIRMING_ORGS 1
+
+typedef std::chrono::steady_clock loadgen_clock;
+
+struct SessionResult {
+    bool success;
+    bool up_to_date;
+    double session_time;   // Connect to GC response (seconds)
+    double handshake_time; // Session time minus image transfer (seconds)
+    uint32_t image_size;
+};
+
+SessionResult run_device(const tcp::endpoint& endpoint, const std::vector<ConfirmingOrg>& orgs,
+                         uint32_t quorum, uint32_t id, uint32_t version) {
+    /**
+     * Runs one full update session (UpdateCheck, G_U with image, G_C) as the
+     * device with the given ID and installed version. The image is discarded.
+     * If the server has parallel authentication, each G_C,i runs on its own
+     * connection alongside G_U and the session completes once quorum of them agree.
+     */
+    SessionResult result = {false, false, 0, 0, 0};
+    const auto start = loadgen_clock::now();
+
+    try {
+        asio::io_service io_service;
+        tcp::socket socket (io_service);
+        socket.connect(endpoint);
+
+        UpdateSession session (socket, id, version);
+
+        // Up to date devices are done after the check, like the updater
+        if (!session.check_for_update()) {
+            result.up_to_date = session.up_to_date;
+            result.session_time = std::chrono::duration<double>(loadgen_clock::now() - start).count();
+            result.handshake_time = result.session_time;
+            return result;
+        }
+
+        std::string hash;
+
+        if (session.parallel_auth) {
+            ConfirmingOrgs confirming_orgs (id, version);
+            confirming_orgs.start(orgs);
+
+            // Download the image once the quorum is reached, like the updater
+            std::vector<std::string> hashes;
+            bool confirmed = false;
+
+            session.confirm_image = [&]() {
+                confirmed = confirming_orgs.wait_for_quorum(quorum, hashes);
+                return confirmed;
+            };
+
+            const bool updated = session.run_protocol(Org::GU, hash);
+            socket.close();
+
+            result.success = updated && confirmed;
+        } else {
+            result.success = session.run_protocol(Org::GU, hash) && session.run_protocol(Org::GC, hash);
+            socket.close();
+        }
+
+        result.up_to_date = session.up_to_date;
+        result.image_size = session.image_size;
+
+        result.session_time = std::chrono::duration<double>(loadgen_clock::now() - start).count();
+        result.handshake_time = result.session_time - session.image_time;
+    } catch (std::exception& e) {
+        result.success = false;
+    }
+
+    return result;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty())
+        return 0;
+
+    size_t rank = (size_t)(p / 100.0 * sorted.size() + 0.5);
+    rank = std::max<size_t>(1, std::min(rank, sorted.size()));
+
+    return sorted[rank - 1];
+}
+
+void print_latencies(const char* name, std::vector<double>& samples) {
+    std::sort(samples.begin(), samples.end());
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+              << " p50 " << std::setw(8) << percentile(samples, 50) * 1000
+              << " p90 " << std::setw(8) << percentile(samples, 90) * 1000
+              << " p99 " << std::setw(8) << percentile(samples, 99) * 1000
+              << " max " << std::setw(8) << (samples.empty() ? 0 : samples.back() * 1000) << " ms" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cout << "Usage: loadgen <ip> <port> [devices] [concurrency] [versions] [orgs] [quorum]" << std::endl;
+        return 0;
+    }
+
+    const tcp::endpoint endpoint (asio::ip::address::from_string(argv[1]), std::stoi(argv[2], nullptr));
+    const uint32_t num_devices = (argc > 3) ? std::stoi(argv[3], nullptr) : DEFAULT_DEVICES;
+    const uint32_t concurrency = (argc > 4) ? std::stoi(argv[4], nullptr) : DEFAULT_CONCURRENCY;
+    const uint32_t num_versions = (argc > 5) ? std::stoi(argv[5], nullptr) : DEFAULT_VERSIONS;
+    const uint32_t num_orgs = (argc > 6) ? std::stoi(argv[6], nullptr) : DEFAULT_CONFIRMING_ORGS;
+    const uint32_t quorum = (argc > 7) ? std::stoi(argv[7], nullptr) : num_orgs;
+
+    if (num_devices < 1 || concurrency < 1 || num_versions < 1) {
+        std::cout << "Devices, concurrency and versions must be positive" << std::endl;
+        return 1;
+    }
+
+    if (quorum < 1 || quorum > num_orgs) {
+        std::cout << "Quorum must be between 1 and the number of confirming orgs" << std::endl;
+        return 1;
+    }
+
+    const std::vector<ConfirmingOrg> orgs = default_confirming_orgs(endpoint, num_orgs);
+
+    std::cout << "Simulating " << num_devices << " devices, " << concurrency << " at a time, "
+              << num_versions << " installed version(s), " << quorum << " of " << num_orgs << " confirming orgs" << std::endl;
+
+    // Each worker thread acts as one device at a time, with its own simulated cores
+    sim_board_per_thread = true;
+
+    std::atomic<uint32_t> next_device {0};
+    std::vector<std::vector<SessionResult>> results (concurrency);
+    std::vector<std::thread> workers;
+
+    const auto start = loadgen_clock::now();
+
+    for (uint32_t w = 0; w < concurrency; w++) {
+        workers.push_back(std::thread([&, w]() {
+            uint32_t device;
+
+            while ((device = next_device++) < num_devices) {
+                // Versions 1..num_versions, spread over the devices
+                const uint32_t version = 1 + device % num_versions;
+                results[w].push_back(run_device(endpoint, orgs, quorum, FIRST_DEVICE_ID + device, version));
+            }
+        }));
+    }
+
+    for (std::thread& worker: workers)
+        worker.join();
+
+    const double elapsed = std::chrono::duration<double>(loadgen_clock::now() - start).count();
+
+    // Aggregate per-worker results
+    uint32_t succeeded = 0, up_to_date = 0, failed = 0;
+    uint64_t image_bytes = 0;
+    std::vector<double> session_times, handshake_times;
+
+    for (const std::vector<SessionResult>& worker_results: results) {
+        for (const SessionResult& result: worker_results) {
+            if (result.success) {
+                succeeded++;
+                image_bytes += result.image_size;
+                session_times.push_back(result.session_time);
+                handshake_times.push_back(result.handshake_time);
+            } else if (result.up_to_date) {
+                up_to_date++;
+            } else {
+                failed++;
+            }
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Sessions: " << succeeded << " updated, " << up_to_date << " up to date, "
+              << failed << " failed in " << elapsed << " s" << std::endl;
+    std::cout << "Throughput: " << succeeded / elapsed << " sessions/s, "
+              << image_bytes / elapsed / 1048576.0 << " MB/s of image data" << std::endl;
+
+    print_latencies("Handshake latency", handshake_times);
+    print_latencies("Session latency", session_times);
+
+    return failed == 0 ? 0 : 1;
+}
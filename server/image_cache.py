@@ -0,0 +1,209 @@
+import os
+import hashlib
+import threading
+import collections
+
+from Crypto.Cipher import AES
+
+import rsa512
+
+# Directory holding the encrypted images
+CACHE_DIR = 'cache'
+
+# Plaintext is read and encrypted in blocks of this size
+# (a multiple of the 53 byte RSA chunk size, so only the last block is padded)
+BLOCK_SIZE = 53 * 1024
+
+# Encrypted image as sent to devices: path to the ciphertext, its size, and the
+# RSA encrypted AES session key (key || nonce) in hybrid mode, or None
+CachedImage = collections.namedtuple('CachedImage', ['path', 'size', 'session_key'])
+
+def key_fingerprint(pubkey):
+    """
+        Returns a short hex identifier of an RSA public key.
+    """
+    return hashlib.sha256('{0:x}:{1:x}'.format(pubkey.n, pubkey.e).encode()).hexdigest()[:16]
+
+class EncryptedImageCache:
+    """
+        Encrypts each update image once per device public key and keeps the
+        result on disk, so sessions only have to send a file.
+
+        Entries are keyed by (image content digest, public key). In hybrid mode
+        an entry has its own random session key (AES key and nonce), which is
+        reused for every session and device that gets the entry, for as long as
+        the entry exists: until the image content changes or cache/ is cleared
+        (delete it to rekey). Devices sharing a public key thus get the same
+        ciphertext of the same image, which only tells an observer that the
+        images are equal; the key stream is never applied to different content.
+    """
+    def __init__(self, encrypt=True, hybrid=True, cache_dir=CACHE_DIR):
+        self.encrypt = encrypt
+        self.hybrid = hybrid
+        self.cache_dir = cache_dir
+
+        # Image digests by (path, mtime, size), so images are only hashed when they change
+        self.digests = {}
+
+        # Built entries by cache file path, and locks so each entry is built once
+        self.entries = {}
+        self.locks = collections.defaultdict(threading.Lock)
+        self.lock = threading.Lock()
+
+        os.makedirs(cache_dir, exist_ok=True)
+
+    def image_digest(self, image_path):
+        st = os.stat(image_path)
+        key = (image_path, st.st_mtime_ns, st.st_size)
+
+        with self.lock:
+            digest = self.digests.get(key)
+
+        if digest is None:
+            h = hashlib.sha256()
+
+            with open(image_path, 'rb') as f:
+                for block in iter(lambda: f.read(1 << 20), b''):
+                    h.update(block)
+
+            digest = h.hexdigest()[:32]
+
+            with self.lock:
+                self.digests[key] = digest
+
+        return digest
+
+    def get(self, image_path, pubkey, wait=True):
+        """
+            Returns the CachedImage for the given image encrypted to pubkey,
+            building it first if it isn't cached yet.
+
+            If wait is False and another thread is building the entry, returns
+            None instead of blocking (see EncryptingReader for the alternative).
+        """
+        if not self.encrypt:
+            return CachedImage(image_path, os.path.getsize(image_path), None)
+
+        # rsa2: RSA entries end with a length padding chunk (older 'rsa' entries don't)
+        mode = 'aes' if self.hybrid else 'rsa2'
+        name = '{0}_{1}.{2}'.format(self.image_digest(image_path), key_fingerprint(pubkey), mode)
+        path = os.path.join(self.cache_dir, name)
+
+        with self.lock:
+            entry_lock = self.locks[path]
+
+        # Another session is building this entry: don't wait for it
+        if not entry_lock.acquire(blocking=wait):
+            return None
+
+        try:
+            entry = self.entries.get(path)
+
+            if entry is None:
+                entry = self.load(path)
+
+            if entry is None:
+                entry = self.build(image_path, pubkey, path)
+
+            self.entries[path] = entry
+        finally:
+            entry_lock.release()
+
+        return entry
+
+    def load(self, path):
+        """
+            Returns a previously built entry from disk, or None.
+        """
+        if not os.path.exists(path):
+            return None
+
+        session_key = None
+
+        if self.hybrid:
+            if not os.path.exists(path + '.sk'):
+                return None
+
+            with open(path + '.sk', 'rb') as f:
+                session_key = f.read()
+
+        return CachedImage(path, os.path.getsize(path), session_key)
+
+    def build(self, image_path, pubkey, path):
+        """
+            Encrypts image_path to pubkey into path, streaming block by block.
+        """
+        # Write to a temporary file first so readers never see a partial image
+        temp_path = '{0}.{1}.tmp'.format(path, threading.get_ident())
+
+        with open(image_path, 'rb') as image, open(temp_path, 'wb') as out:
+            reader = EncryptingReader(image, pubkey, self.hybrid)
+
+            for block in reader.blocks():
+                out.write(block)
+
+        if reader.session_key is not None:
+            with open(path + '.sk', 'wb') as f:
+                f.write(reader.session_key)
+
+        os.replace(temp_path, path)
+
+        return CachedImage(path, os.path.getsize(path), reader.session_key)
+
+    def warm(self, image_paths, pubkey):
+        """
+            Builds the entries for all given images, e.g., when a release is
+            published, and returns them by image path.
+        """
+        return {image_path: self.get(image_path, pubkey) for image_path in image_paths}
+
+class EncryptingReader:
+    """
+        Encrypts an image for one session while it is being sent, one block at
+        a time, so memory use doesn't depend on the image size. Used when the
+        image isn't in the cache.
+
+        Reads the open image file at explicit offsets, so sessions can share it.
+    """
+    def __init__(self, image_file, pubkey, hybrid):
+        self.image_file = image_file
+        self.hybrid = hybrid
+        self.rsa = rsa512.RSA512(pubkey)
+        self.session_key = None
+
+        plaintext_size = os.fstat(image_file.fileno()).st_size
+
+        if hybrid:
+            # 128-bit session key and 64-bit nonce (block counter starts at 0)
+            key = os.urandom(16)
+            nonce = os.urandom(8)
+
+            self.cipher = AES.new(key, AES.MODE_CTR, nonce=nonce)
+            self.session_key = self.rsa.encrypt(key + nonce)
+            self.size = plaintext_size
+        else:
+            # Every 53 byte chunk becomes a 64 byte RSA block, and the last
+            # one always carries the length padding (a chunk of its own if the
+            # image fills its chunks)
+            self.size = (plaintext_size // 53 + 1) * 64
+
+    def blocks(self):
+        """
+            Yields the ciphertext block by block.
+        """
+        fd = self.image_file.fileno()
+        offset = 0
+
+        block = os.pread(fd, BLOCK_SIZE, offset)
+
+        while block:
+            offset += len(block)
+            next_block = os.pread(fd, BLOCK_SIZE, offset)
+
+            if self.hybrid:
+                yield self.cipher.encrypt(block)
+            else:
+                # Only the final block carries the length padding
+                yield self.rsa.encrypt(block, final=not next_block)
+
+            block = next_block
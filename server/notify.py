@@ -0,0 +1,125 @@
+import time
+import socket
+import selectors
+import threading
+
+import protocol_pb2
+
+def encode_delimited(message):
+    # Varint length prefix followed by the message, so that a message sent right
+    # after it (M1 after UpdateStatus) can be told apart by the device
+    data = message.SerializeToString()
+    size = len(data)
+    prefix = bytearray()
+
+    while size >= 0x80:
+        prefix.append((size & 0x7F) | 0x80)
+        size >>= 7
+
+    prefix.append(size)
+
+    return bytes(prefix) + data
+
+def status_message(available):
+    status = protocol_pb2.UpdateStatus()
+    status.successful = available
+
+    return encode_delimited(status)
+
+class ReleaseNotifier:
+    """
+        Notification channel to updater daemons: devices keep a connection open
+        and are sent UpdateStatus(successful=True) when a release is published,
+        so they can poll rarely and still update within seconds. An
+        UpdateStatus(successful=False) is sent every heartbeat interval so that
+        devices notice a dead connection.
+
+        All connections are served by a single thread; devices never send
+        anything, so a connection only needs a socket and no worker.
+    """
+    RELEASE = status_message(True)
+    HEARTBEAT = status_message(False)
+
+    def __init__(self, address, heartbeat, backlog):
+        self.heartbeat = heartbeat
+
+        self.listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self.listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.listener.bind(address)
+        self.listener.listen(backlog)
+        self.listener.setblocking(False)
+
+        # Written by announce() to wake up the serving thread
+        self.wakeup_recv, self.wakeup_send = socket.socketpair()
+        self.wakeup_recv.setblocking(False)
+
+        self.selector = selectors.DefaultSelector()
+        self.selector.register(self.listener, selectors.EVENT_READ)
+        self.selector.register(self.wakeup_recv, selectors.EVENT_READ)
+
+        self.devices = set()
+
+    def start(self):
+        threading.Thread(target=self.serve, daemon=True).start()
+
+    def announce(self):
+        """
+            Tells all connected devices that a new release is available (from any thread).
+        """
+        self.wakeup_send.send(b'\x01')
+
+    def serve(self):
+        next_heartbeat = time.monotonic() + self.heartbeat
+
+        while True:
+            events = self.selector.select(max(0, next_heartbeat - time.monotonic()))
+
+            for key, _ in events:
+                if key.fileobj is self.listener:
+                    self.accept()
+                elif key.fileobj is self.wakeup_recv:
+                    self.drain_wakeup()
+                    self.send_all(self.RELEASE)
+                else:
+                    # Devices don't send anything: this is a close or an error
+                    self.drop(key.fileobj)
+
+            if time.monotonic() >= next_heartbeat:
+                self.send_all(self.HEARTBEAT)
+                next_heartbeat = time.monotonic() + self.heartbeat
+
+    def accept(self):
+        while True:
+            try:
+                device, _ = self.listener.accept()
+            except (BlockingIOError, InterruptedError):
+                return
+            except OSError as e:
+                # E.g., out of file descriptors: retry on the next event
+                print('* Notification channel accept failed: {0}'.format(e))
+                return
+
+            device.setblocking(False)
+            self.selector.register(device, selectors.EVENT_READ)
+            self.devices.add(device)
+
+    def drain_wakeup(self):
+        try:
+            while self.wakeup_recv.recv(64):
+                pass
+        except (BlockingIOError, InterruptedError):
+            pass
+
+    def send_all(self, message):
+        for device in list(self.devices):
+            try:
+                # A few bytes always fit in the send buffer of a live connection
+                if device.send(message) != len(message):
+                    self.drop(device)
+            except OSError:
+                self.drop(device)
+
+    def drop(self, device):
+        self.selector.unregister(device)
+        self.devices.discard(device)
+        device.close()
@@ -0,0 +1,196 @@
+import os
+import re
+import time
+import threading
+
+from update_image import read_image_header, read_base_hash
+
+class Release:
+    """
+        Metadata of a published update image and its deltas, loaded once and
+        shared by all sessions.
+    """
+    def __init__(self, image_path, delta_path_format, version_path, default_version):
+        self.image_path = image_path
+
+        # Delta images by the installed version they apply to
+        self.deltas = find_deltas(delta_path_format)
+
+        # Taken first: if the files still match it after loading, everything
+        # below was read from the same files (see ReleaseManager.reload())
+        self.stamp = release_stamp(image_path, self.deltas.values(), version_path)
+
+        # Sessions send the images from these files, which keep the contents
+        # of this release after newer images are renamed into place
+        self.files = {path: open(path, 'rb') for path in self.images()}
+
+        header = read_image_header(image_path)
+
+        self.lengths = header[:-1]
+        self.hash = header[-1]
+
+        # Version devices are told about and install (M1's V)
+        self.version = read_version(version_path, default_version)
+
+        # Header hash of the image each delta was built against
+        self.delta_bases = {version: read_base_hash(path) for version, path in self.deltas.items()}
+
+        # Encrypted images (CachedImage) by image path, if set by on_load
+        self.cached = {}
+
+    def image_for(self, version, installed_hash):
+        """
+            Returns the image to send to a device with the given installed
+            version and image hash: the delta for its version if that was built
+            against the installed image, otherwise the full image (e.g., on a
+            first install, or if the device has a different image).
+        """
+        if self.is_delta(version, installed_hash):
+            return self.deltas[version]
+
+        return self.image_path
+
+    def is_delta(self, version, installed_hash):
+        return version in self.deltas and installed_hash == self.delta_bases[version]
+
+    def images(self):
+        return [self.image_path] + list(self.deltas.values())
+
+def find_deltas(delta_path_format):
+    """
+        Returns the published delta images by the installed version they apply to.
+    """
+    deltas = {}
+
+    directory = os.path.dirname(delta_path_format) or '.'
+    prefix, suffix = os.path.basename(delta_path_format).split('{0}')
+    pattern = re.compile('^' + re.escape(prefix) + r'(\d+)' + re.escape(suffix) + '$')
+
+    for name in os.listdir(directory):
+        match = pattern.match(name)
+
+        if match:
+            deltas[int(match.group(1))] = os.path.join(directory, name)
+
+    return deltas
+
+def read_version(version_path, default_version):
+    """
+        Returns the version number in the version file, or default_version if
+        there is no such file.
+    """
+    try:
+        with open(version_path) as f:
+            return int(f.read().strip())
+    except FileNotFoundError:
+        return default_version
+
+def release_stamp(image_path, delta_paths, version_path):
+    """
+        Cheap fingerprint of the published files (paths, sizes and modification times).
+    """
+    stamp = []
+
+    for path in [image_path] + sorted(delta_paths):
+        st = os.stat(path)
+        stamp.append((path, st.st_size, st.st_mtime_ns))
+
+    # The version file is optional
+    try:
+        st = os.stat(version_path)
+        stamp.append((version_path, st.st_size, st.st_mtime_ns))
+    except FileNotFoundError:
+        pass
+
+    return stamp
+
+class ReleaseManager:
+    """
+        Holds the current Release. A new release is loaded by reload(), either on
+        request (SIGHUP) or when polling notices that the published files
+        changed. Sessions keep the Release they started with and send its open
+        image files or the cache entries built from them, so a session never
+        mixes the image of one release with the hash or version of another.
+
+        Publish images by writing them elsewhere and renaming them into place.
+    """
+    def __init__(self, image_path, delta_path_format, version_path, default_version, on_load=None, on_change=None):
+        self.image_path = image_path
+        self.delta_path_format = delta_path_format
+        self.version_path = version_path
+        self.default_version = default_version
+
+        # Called with a newly loaded release before sessions start using it
+        self.on_load = on_load
+
+        # Called with a newly loaded release and the one it replaces (None at
+        # startup) once sessions use it
+        self.on_change = on_change
+
+        self.release = None
+        self.lock = threading.Lock()
+
+    def current(self):
+        return self.release
+
+    def reload(self):
+        """
+            Loads the published release if it changed since the last load.
+
+            Returns: True if a new release was loaded
+        """
+        with self.lock:
+            release = Release(self.image_path, self.delta_path_format, self.version_path, self.default_version)
+
+            if self.release is not None and release.stamp == self.release.stamp:
+                return False
+
+            if self.on_load:
+                self.on_load(release)
+
+            # Files replaced while loading may not match what was read before
+            if self.files_changed(release):
+                raise ValueError('published files changed while loading')
+
+            previous = self.release
+            self.release = release
+
+        if self.on_change:
+            self.on_change(release, previous)
+
+        return True
+
+    def changed(self):
+        """
+            Returns True if the published files differ from the current release.
+        """
+        release = self.release
+        return release is None or self.files_changed(release)
+
+    def files_changed(self, release):
+        try:
+            deltas = find_deltas(self.delta_path_format)
+            return release_stamp(self.image_path, deltas.values(), self.version_path) != release.stamp
+        except OSError:
+            return True
+
+    def watch(self, interval):
+        """
+            Starts a background thread that reloads the release when it changes.
+        """
+        def poll():
+            while True:
+                time.sleep(interval)
+
+                if self.changed():
+                    self.reload_safely()
+
+        threading.Thread(target=poll, daemon=True).start()
+
+    def reload_safely(self):
+        try:
+            if self.reload():
+                print('* Loaded release {0} with hash {1}'.format(self.release.version, self.release.hash.hex()))
+        except (OSError, IndexError, ValueError) as e:
+            # Keep serving the current release, e.g., while a file is half written
+            print('* Failed to load release: {0}'.format(e))
@@ -8,11 +8,17 @@ class RSA512:
         self.pubkey = pubkey
         self.prvkey = prvkey
 
-    def encrypt(self, plaintext):
+    def encrypt(self, plaintext, final=True):
         """
             Given a plaintext as a byte string, encrypts the string in a block-by-block fashion
             using PKCS#1 v1.5.
 
+            If final is False, plaintext is one part of a longer message: its length must be
+            a multiple of the chunk size, and no padded last chunk is added. Otherwise the
+            last chunk always carries the length padding, even if the plaintext fills its
+            chunks: then a chunk of padding only is added, so the receiver never has to
+            guess whether the last chunk is padded.
+
             Returns: ciphertext as byte string
         """
         # Divide plaintext into 53 byte chunks
@@ -30,8 +36,11 @@ class RSA512:
             # Append to final ciphertext
             ciphertext += enc
 
+        if not final:
+            return bytes(ciphertext)
+
         # For last chunk, left pad with size of padding before encrypting
-        last_chunk = plaintext[-last_chunk_size:]
+        last_chunk = plaintext[len(plaintext) - last_chunk_size:]
         padding = [CHUNK_SIZE-last_chunk_size]*(CHUNK_SIZE-last_chunk_size)
         last_chunk_padded = bytes(padding) + last_chunk
         ciphertext += rsa.encrypt(last_chunk_padded, self.pubkey)
@@ -1,9 +1,16 @@
+import os
+import time
+import socket
+import signal
 import random
+import threading
 import socketserver
 
 import protocol_pb2
 
-from update_image import read_image_header
+from release import ReleaseManager
+from image_cache import EncryptedImageCache, EncryptingReader
+from notify import ReleaseNotifier, encode_delimited
 import rsa512
 import rsakeys
 
@@ -13,6 +20,10 @@ DEBUG = True
 # Encryption
 ENCRYPT = True
 
+# Hybrid mode: only a random session key is RSA encrypted for the device,
+# the image itself is encrypted with AES-128 in CTR mode
+HYBRID = True
+
 # Protocol states
 IDLE = 1
 AUTH = 2
@@ -24,13 +35,90 @@ DONE = 5
 I_GU = 111
 I_GC = 222
 
-# Current version
+# Parallel authentication: G_U and each G_C,i have their own endpoint (port PORT
+# and PORT+1+i), so devices authenticate with all orgs at the same time.
+# Otherwise G_U and a single G_C run one after another over the G_U connection.
+# Devices follow the mode announced in the UpdateStatus
+PARALLEL_AUTH = True
+
+# Number of G_C,i endpoints in parallel mode (all use the G_C key pair)
+NUM_CONFIRMING_ORGS = 1
+
+# Version of a release published without a version file (VERSION_PATH)
 V = 1234
 
+# Maximum number of sessions served at the same time; further devices wait in the listen queue
+MAX_WORKERS = 64
+
+# Connections accepted by the OS but not yet picked up by a worker
+LISTEN_BACKLOG = 1024
+
+# A session is dropped if a message receive or send blocks for longer than this (seconds)
+IO_TIMEOUT = 30
+
+# Or if the whole session takes longer than this (seconds)
+SESSION_TIMEOUT = 600
+
 # Path to update image
 IMAGE_PATH = 'output_image.bin'
 
+# Path to delta image against the image installed on devices with the given version
+# Built with: update_image.py delta <installed_image> <IMAGE_PATH> delta_<version>.bin
+DELTA_IMAGE_PATH = 'delta_{0}.bin'
+
+# Version of the published image: a file holding the version number, published
+# with the image. Devices with any other installed version are offered the update
+VERSION_PATH = 'output_image.version'
+
+# Keep encrypted images on disk and send them with sendfile. Otherwise each session
+# encrypts the image block by block while sending it (also used while the cache
+# entry for an image is still being built by another session)
+CACHE_IMAGES = True
+
+# Update images encrypted to the device key, built once per image
+IMAGE_CACHE = EncryptedImageCache(encrypt=ENCRYPT, hybrid=HYBRID)
+
+# RSA512 objects for each party, shared by all sessions
+D_RSA = rsa512.RSA512(rsakeys.D_PUB, None)
+GU_RSA = rsa512.RSA512(rsakeys.GU_PUB, rsakeys.GU_PRV)
+GC_RSA = rsa512.RSA512(rsakeys.GC_PUB, rsakeys.GC_PRV)
+
+# Check for a newly published image every this many seconds (or send SIGHUP)
+RELEASE_POLL_INTERVAL = 10
+
+# Notification channel: updater daemons keep a connection open on port PORT-1
+# and check for an update as soon as a release with a new version is loaded
+NOTIFY = True
+
+# Keepalive message interval on the notification channel (seconds)
+NOTIFY_HEARTBEAT = 60
+
+# Set in main if NOTIFY is enabled
+NOTIFIER = None
+
+def load_release(release):
+    # Encrypt the full image and all deltas before sessions use the new
+    # release. Its sessions send these entries, whatever is published meanwhile
+    if CACHE_IMAGES and ENCRYPT:
+        release.cached = IMAGE_CACHE.warm(release.images(), rsakeys.D_PUB)
+
+def announce_release(release, previous):
+    # Sessions now offer the new version: tell the waiting devices to check.
+    # A republished image with the same version isn't offered to anyone
+    if NOTIFIER is not None and previous is not None and release.version != previous.version:
+        NOTIFIER.announce()
+
+# Published image, deltas and their header data
+RELEASES = ReleaseManager(IMAGE_PATH, DELTA_IMAGE_PATH, VERSION_PATH, V, on_load=load_release, on_change=announce_release)
+
 class ProtocolStateHandler(socketserver.BaseRequestHandler):
+    # Only run the G_C protocol (endpoint of a confirming org)
+    confirming_only = False
+
+    def setup(self):
+        # Don't let a stalled device hold on to a worker
+        self.request.settimeout(IO_TIMEOUT)
+
     def idle_state(self):
         data = self.request.recv(512)
         
@@ -43,15 +131,22 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
             return False
         
         self.ID = uc.ID
+        self.device_version = uc.V
+        self.installed_hash = uc.HI
 
-        # Ignore message if device version is current
-        # Stop connection
-        if uc.V == V:
-            self.request.sendall(b'\xFF')
+        # Tell the device whether an update is available before any RSA work;
+        # if not, that's the whole session
+        status = protocol_pb2.UpdateStatus()
+        status.successful = uc.V != self.release.version
+        status.parallel_auth = PARALLEL_AUTH
+
+        self.request.sendall(encode_delimited(status))
+
+        if not status.successful:
             return False
 
-        # Number of authentications made
-        self.num_auths = 0
+        # Number of authentications made (a confirming org starts at G_C)
+        self.num_auths = 1 if self.confirming_only else 0
 
         if DEBUG:
             print('- Got UpdateCheck from ID={0}'.format(self.ID))
@@ -81,7 +176,7 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
 
         # Build full message including V
         m1 = protocol_pb2.M1()
-        m1.V = V
+        m1.V = self.release.version
 
         # Encrypt if not in debug mode
         if ENCRYPT:
@@ -143,28 +238,59 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
         if DEBUG:
             print('- GU sent UpdatingOrgResponse(ND={0}, IG={1}) to ID={2}'.format(ur.ND, ur.IG, self.ID))
 
-        # Next, send the update image
-        with open(IMAGE_PATH, 'rb') as f:
-            content = f.read()
+        # Send a delta if one was published against the installed image, otherwise the full image
+        image_path = self.release.image_for(self.device_version, self.installed_hash)
 
-            # Send the length of the update image first to simplify buffer allocation
-            ui = protocol_pb2.UpdateImage()
-            
-            if ENCRYPT:
-                encrypted = self.d_rsa.encrypt(content)
-                ui.size = len(encrypted)
-            else:
-                ui.size = len(content)
-            
-            self.request.sendall(ui.SerializeToString())
+        if DEBUG and self.release.is_delta(self.device_version, self.installed_hash):
+            print('- GU sending delta image {0} to ID={1}'.format(image_path, self.ID))
 
-            # Wait for OK to continue
-            _ = self.request.recv(512)
-            
-            if ENCRYPT:
-                self.request.sendall(encrypted)
-            else:
-                self.request.sendall(content)
+        # Next, send the release's copy of the update image: its cache entry if
+        # possible, otherwise its open file (encrypted while sending)
+        image = self.release.cached.get(image_path)
+        image_file = self.release.files[image_path]
+
+        if image is not None:
+            size, session_key = image.size, image.session_key
+        elif not ENCRYPT:
+            size, session_key = os.fstat(image_file.fileno()).st_size, None
+        else:
+            reader = EncryptingReader(image_file, rsakeys.D_PUB, HYBRID)
+            size, session_key = reader.size, reader.session_key
+
+        # Send the length of the update image first to simplify buffer allocation
+        ui = protocol_pb2.UpdateImage()
+        ui.size = size
+
+        if session_key:
+            ui.SK = session_key
+
+        self.request.sendall(ui.SerializeToString())
+
+        # Wait for OK to continue
+        data = self.request.recv(512)
+
+        # Device closed the connection instead, e.g., because the confirming orgs disagree
+        if not data:
+            if DEBUG:
+                print('- ID={0} declined the update image'.format(self.ID))
+
+            return False
+
+        # The whole image must go out before the session deadline, not within IO_TIMEOUT
+        self.request.settimeout(max(IO_TIMEOUT, self.deadline - time.monotonic()))
+
+        if image is not None:
+            # Zero-copy send of the pre-encrypted file
+            with open(image.path, 'rb') as f:
+                self.request.sendfile(f)
+        elif not ENCRYPT:
+            # Zero-copy from offset 0 of the shared file (sendfile doesn't use its position)
+            self.request.sendfile(image_file)
+        else:
+            for block in reader.blocks():
+                self.request.sendall(block)
+
+        self.request.settimeout(IO_TIMEOUT)
 
         # Wait for client to confirm
         _ = self.request.recv(512)
@@ -172,8 +298,8 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
         if DEBUG:
             print('- GU sent update image to ID={0}'.format(self.ID))
 
-        # Authenticate GC next
-        self.current_state = AUTH
+        # Authenticate GC next, unless it has its own endpoint
+        self.current_state = DONE if PARALLEL_AUTH else AUTH
 
         return True
 
@@ -214,8 +340,7 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
         cr.IG = I_GC
 
         # Append hash of update image to OrgResponse
-        headers = read_image_header(IMAGE_PATH)
-        cr.HC = headers[-1]
+        cr.HC = self.release.hash
 
         m3 = protocol_pb2.M3()
 
@@ -241,15 +366,31 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
         self.N_GC = random.randint(1, 1000000000)
 
         # RSA512 objects for each party
-        self.d_rsa = rsa512.RSA512(rsakeys.D_PUB, None)
-        self.gu_rsa = rsa512.RSA512(rsakeys.GU_PUB, rsakeys.GU_PRV)
-        self.gc_rsa = rsa512.RSA512(rsakeys.GC_PUB, rsakeys.GC_PRV)
+        self.d_rsa = D_RSA
+        self.gu_rsa = GU_RSA
+        self.gc_rsa = GC_RSA
 
-        running = True
+        # Serve the whole session from the release current at its start
+        self.release = RELEASES.current()
+
+        self.deadline = time.monotonic() + SESSION_TIMEOUT
 
         print('* New session with client: {0}'.format(self.client_address))
-        
+
+        try:
+            self.run_states()
+        except socket.timeout:
+            print('* Session with client {0} timed out'.format(self.client_address))
+        except OSError as e:
+            print('* Session with client {0} failed: {1}'.format(self.client_address, e))
+
+    def run_states(self):
+        running = True
+
         while running:
+            if time.monotonic() > self.deadline:
+                raise socket.timeout('session deadline exceeded')
+
             if self.current_state == IDLE:
                 running = self.idle_state()
             elif self.current_state == AUTH:
@@ -261,8 +402,61 @@ class ProtocolStateHandler(socketserver.BaseRequestHandler):
             elif self.current_state == DONE:
                 running = False
 
+class ConfirmingOrgHandler(ProtocolStateHandler):
+    """
+        Endpoint of a confirming org G_C,i: UpdateCheck, then the G_C protocol only.
+    """
+    confirming_only = True
+
+class UpdateServer(socketserver.ThreadingMixIn, socketserver.TCPServer):
+    """
+        Serves each session on its own thread, at most MAX_WORKERS at a time.
+        Each session still runs the ProtocolStateHandler state machine from start to end.
+    """
+    allow_reuse_address = True
+    daemon_threads = True
+    request_queue_size = LISTEN_BACKLOG
+
+    def __init__(self, server_address, handler_class, max_workers=MAX_WORKERS):
+        self.workers = threading.BoundedSemaphore(max_workers)
+        super().__init__(server_address, handler_class)
+
+    def process_request(self, request, client_address):
+        # Stop accepting while all workers are busy
+        self.workers.acquire()
+
+        try:
+            super().process_request(request, client_address)
+        except:
+            self.workers.release()
+            raise
+
+    def process_request_thread(self, request, client_address):
+        try:
+            super().process_request_thread(request, client_address)
+        finally:
+            self.workers.release()
+
 if __name__ == "__main__":
     HOST, PORT = '0.0.0.0', 8080
 
-    server = socketserver.TCPServer((HOST, PORT), ProtocolStateHandler)
+    # Load (and encrypt) the published release before devices check in
+    RELEASES.reload()
+
+    if NOTIFY:
+        NOTIFIER = ReleaseNotifier((HOST, PORT - 1), NOTIFY_HEARTBEAT, LISTEN_BACKLOG)
+        NOTIFIER.start()
+
+    RELEASES.watch(RELEASE_POLL_INTERVAL)
+
+    # SIGHUP: reload now, e.g., right after publishing a new image
+    signal.signal(signal.SIGHUP, lambda signum, frame: threading.Thread(target=RELEASES.reload_safely).start())
+
+    # Confirming orgs listen on the following ports, each with its own workers
+    if PARALLEL_AUTH:
+        for i in range(NUM_CONFIRMING_ORGS):
+            gc_server = UpdateServer((HOST, PORT + 1 + i), ConfirmingOrgHandler)
+            threading.Thread(target=gc_server.serve_forever, daemon=True).start()
+
+    server = UpdateServer((HOST, PORT), ProtocolStateHandler)
     server.serve_forever()
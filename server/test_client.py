@@ -18,10 +18,36 @@ s.send(uc.SerializeToString())
 
 print('Sent: UpdateCheck(ID={0}, V={1})'.format(uc.ID, uc.V))
 
+def receive_status(s):
+    # UpdateStatus is sent with a varint length prefix; M1 may follow in the same read
+    data = s.recv(512)
+    size, pos = 0, 0
+
+    while True:
+        size |= (data[pos] & 0x7F) << (7 * pos)
+        pos += 1
+
+        if data[pos - 1] < 0x80:
+            break
+
+    status = protocol_pb2.UpdateStatus()
+    status.ParseFromString(data[pos:pos + size])
+
+    return status, data[pos + size:]
+
+status, data = receive_status(s)
+print('Received: UpdateStatus(successful={0}, parallel_auth={1})'.format(status.successful, status.parallel_auth))
+
+if not status.successful:
+    print('Device is up to date.')
+    s.close()
+    exit()
+
 ### For GU
 
 # Parse M1 and OrgChallenge response from GU
-data = s.recv(512)
+if not data:
+    data = s.recv(512)
 
 m1 = protocol_pb2.M1()
 m1.ParseFromString(data)
@@ -72,8 +98,22 @@ s.send(b'OK')
 
 ### Now for GC
 
+# With parallel authentication, the confirming org listens on the next port:
+# connect and send the UpdateCheck again
+if status.parallel_auth:
+    s.close()
+
+    s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    s.connect((HOST, PORT + 1))
+    s.send(uc.SerializeToString())
+
+    _, data = receive_status(s)
+else:
+    data = b''
+
 # Parse M1 and OrgChallenge response from GC
-data = s.recv(512)
+if not data:
+    data = s.recv(512)
 
 m1 = protocol_pb2.M1()
 m1.ParseFromString(data)
@@ -3,6 +3,7 @@ import sys
 import struct
 import binascii
 
+import lz4.frame
 import sha3
 
 """
@@ -31,8 +32,49 @@ import sha3
 
         Input: BOOT.bin, image.ub, app (32-bit ARM ELF)
         Output: update image
+
+    The upper bits of the num_fields byte are reserved for image flags (see FLAG_*).
+
+    Delta image format:
+
+        A delta image patches the body of the currently installed (base) image into the body of
+        the new (target) image. Its header is identical to the one of the target image, except
+        that FLAG_DELTA is set and the hash of the base body is appended:
+
+            1 byte              4 bytes     ...     4 bytes             64 bytes                 64 bytes
+        +--------------------+-------------+-----+-------------+-----------------------+---------------------+
+        | FLAG_DELTA | n     | len(file_1) | ... | len(file_n) | Keccak512(target body) | Keccak512(base body) |
+        +--------------------+-------------+-----+-------------+-----------------------+---------------------+
+
+        Body: sequence of patch operations applied in order to build the target body
+
+            COPY:   1 byte (OP_COPY) | 4 bytes (offset in base body) | 4 bytes (length)
+            DATA:   1 byte (OP_DATA) | 4 bytes (length) | <length> bytes of literal data
+
+    Compressed images:
+
+        Any image (full or delta) can have its body compressed, in which case FLAG_COMPRESSED is
+        set and the body is stored as a single LZ4 frame. Frames use blocks of at most 64 KB, and
+        matches never reach back further than 64 KB, so that the device can decompress with a
+        small, bounded window. The header
+        (including the hash, which is always computed over the uncompressed body) is unchanged.
 """
 
+# Flags stored in the upper bits of the num_fields byte
+FIELD_COUNT_MASK = 0x3F
+FLAG_DELTA = 0x80
+FLAG_COMPRESSED = 0x40
+
+# Delta patch operations
+OP_COPY = 0x01
+OP_DATA = 0x02
+
+# Size of the blocks matched against the base image when building a delta
+DELTA_BLOCK_SIZE = 512
+
+# Size of the chunks fed to the compressor
+COMPRESS_CHUNK_SIZE = 65536
+
 def convert_binary(b):
     """Convert a binary value (byte array) to a readable hex string."""
     return binascii.hexlify(b).decode()
@@ -73,8 +115,8 @@ def read_image_header(image_path):
     header = []
     
     with open(image_path, 'rb') as f:
-        # Read in field count
-        num_fields = f.read(1)[0]
+        # Read in field count (ignoring image flags)
+        num_fields = f.read(1)[0] & FIELD_COUNT_MASK
 
         # Read in each length field
         for i in range(num_fields):
@@ -91,16 +133,53 @@ def read_image_header(image_path):
     
     return header
 
-def write_image_header(output_image, lengths):
+def read_base_hash(image_path):
+    """
+        Returns the hash of the base body that a delta image applies to (see format above).
+    """
+    with open(image_path, 'rb') as f:
+        num_fields = f.read(1)[0] & FIELD_COUNT_MASK
+
+        # Skip the length fields and the target hash
+        f.seek(1 + 4 * num_fields + 64)
+        return f.read(64)
+
+def read_image_flags(image_path):
+    """
+        Returns the flags (FLAG_*) set in the header of the given update image.
+    """
+    with open(image_path, 'rb') as f:
+        return f.read(1)[0] & ~FIELD_COUNT_MASK
+
+def read_image_body(image_path):
+    """
+        Reads in the body of a (non-delta) update image, i.e., everything following the header.
+        Compressed bodies are decompressed.
+
+        Returns: body as (bytes)
+    """
+    num_fields = len(read_image_header(image_path)) - 1
+
+    with open(image_path, 'rb') as f:
+        f.seek(1 + num_fields * 4 + 64)
+        body = f.read()
+
+    if read_image_flags(image_path) & FLAG_COMPRESSED:
+        body = lz4.frame.decompress(body)
+
+    return body
+
+def write_image_header(output_image, lengths, flags=0):
     """
         Write header to given output image (without the hash).
 
         Arguments:
             - output_image: output image file -> (file object)
             - lengths: list of lengths of each input file -> (list of int)
+            - flags: image flags to store alongside the field count -> (int)
     """
     # Write number of fields as unsigned char
-    b = struct.pack('<B', len(lengths))
+    b = struct.pack('<B', len(lengths) | flags)
     output_image.write(b)
 
     # Write input file lengths
@@ -158,7 +237,191 @@ def write_image_body(output_image, inputs, lengths):
 
     return k.hexdigest()
 
+def rolling_checksum(block):
+    """
+        Computes the rsync-style weak checksum of a block.
+
+        Returns: tuple of (checksum, a, b) where a and b are the running sums
+    """
+    a = sum(block) & 0xFFFF
+    b = sum((len(block) - i) * x for i, x in enumerate(block)) & 0xFFFF
+
+    return (a | (b << 16), a, b)
+
+def match_length(base, base_pos, target, target_pos):
+    """
+        Returns the number of bytes that match between base[base_pos:] and target[target_pos:].
+    """
+    length = 0
+    max_length = min(len(base) - base_pos, len(target) - target_pos)
+
+    # Compare large slices first, then narrow down to the first mismatching byte
+    step = 4096
+    while step >= 1:
+        while length + step <= max_length and \
+              base[base_pos+length:base_pos+length+step] == target[target_pos+length:target_pos+length+step]:
+            length += step
+        step //= 16
+
+    return length
+
+def diff_bodies(base, target, block_size=DELTA_BLOCK_SIZE):
+    """
+        Computes a list of patch operations that turn the base body into the target body.
+
+        Blocks of the base body are indexed by their weak checksum, and a rolling checksum over
+        the target is used to find matches at any offset (similar to rsync).
+
+        Arguments:
+            - base: body of the base image -> (bytes)
+            - target: body of the target image -> (bytes)
+            - block_size: size of the blocks to match -> (int)
+
+        Returns: list of (OP_COPY, offset, length) and (OP_DATA, data) tuples
+    """
+    # Index base blocks by weak checksum
+    index = {}
+    for offset in range(0, len(base) - block_size + 1, block_size):
+        checksum = rolling_checksum(base[offset:offset+block_size])[0]
+        index.setdefault(checksum, []).append(offset)
+
+    ops = []
+    literal_start = 0
+    pos = 0
+    checksum = None
+
+    while pos + block_size <= len(target):
+        if checksum is None:
+            checksum, a, b = rolling_checksum(target[pos:pos+block_size])
+
+        # Look for a base block with the same content
+        match = None
+        for offset in index.get(checksum, []):
+            if base[offset:offset+block_size] == target[pos:pos+block_size]:
+                match = offset
+                break
+
+        if match is not None:
+            # Flush literal data preceding the match
+            if literal_start < pos:
+                ops.append((OP_DATA, target[literal_start:pos]))
+
+            # Extend the match as far as possible
+            length = match_length(base, match, target, pos)
+            ops.append((OP_COPY, match, length))
+
+            pos += length
+            literal_start = pos
+            checksum = None
+            continue
+
+        # Roll the checksum forward by one byte
+        if pos + block_size < len(target):
+            out_byte, in_byte = target[pos], target[pos + block_size]
+            a = (a - out_byte + in_byte) & 0xFFFF
+            b = (b - block_size * out_byte + a) & 0xFFFF
+            checksum = a | (b << 16)
+
+        pos += 1
+
+    # Remaining bytes are sent as-is
+    if literal_start < len(target):
+        ops.append((OP_DATA, target[literal_start:]))
+
+    return ops
+
+def build_delta_image(base_path, target_path, output_path='delta_image.bin'):
+    """
+        Builds a delta image that patches the base image into the target image (see format above).
+
+        Arguments:
+            - base_path: path to the currently installed update image -> (string)
+            - target_path: path to the new update image -> (string)
+            - output_path: full (or relative) path to write delta image to -> (string)
+
+        Returns: size of the delta image in bytes
+    """
+    base_header = read_image_header(base_path)
+    target_header = read_image_header(target_path)
+
+    ops = diff_bodies(read_image_body(base_path), read_image_body(target_path))
+
+    with open(output_path, 'wb') as output_image:
+        # Target header with the delta flag set, followed by both hashes
+        write_image_header(output_image, target_header[:-1], FLAG_DELTA)
+        output_image.seek(-64, os.SEEK_CUR)
+        output_image.write(target_header[-1])
+        output_image.write(base_header[-1])
+
+        # Patch operations
+        for op in ops:
+            if op[0] == OP_COPY:
+                output_image.write(struct.pack('<BII', OP_COPY, op[1], op[2]))
+            else:
+                output_image.write(struct.pack('<BI', OP_DATA, len(op[1])))
+                output_image.write(op[1])
+
+        return output_image.tell()
+
+def compress_image(image_path, output_path='compressed_image.bin'):
+    """
+        Compresses the body of a full or delta update image (see format above).
+
+        Arguments:
+            - image_path: path to the uncompressed update image -> (string)
+            - output_path: full (or relative) path to write compressed image to -> (string)
+
+        Returns: size of the compressed image in bytes
+    """
+    flags = read_image_flags(image_path)
+
+    if flags & FLAG_COMPRESSED:
+        raise Exception('Image is already compressed!')
+
+    num_fields = len(read_image_header(image_path)) - 1
+    header_size = 1 + num_fields * 4 + 64
+
+    if flags & FLAG_DELTA:
+        header_size += 64
+
+    with open(image_path, 'rb') as f, open(output_path, 'wb') as output_image:
+        # Copy the header as-is, with the compressed flag set
+        header = bytearray(f.read(header_size))
+        header[0] |= FLAG_COMPRESSED
+        output_image.write(header)
+
+        # Compress the body chunk by chunk into a single frame
+        compressor = lz4.frame.LZ4FrameCompressor(block_size=lz4.frame.BLOCKSIZE_MAX64KB,
+                                                  content_checksum=False)
+        output_image.write(compressor.begin())
+
+        block = f.read(COMPRESS_CHUNK_SIZE)
+
+        while block:
+            output_image.write(compressor.compress(block))
+            block = f.read(COMPRESS_CHUNK_SIZE)
+
+        output_image.write(compressor.flush())
+
+        return output_image.tell()
+
 def main():
+    # Compress an image: update_image.py compress <image> [output]
+    if len(sys.argv) > 1 and sys.argv[1] == 'compress':
+        output = sys.argv[3] if len(sys.argv) > 3 else 'compressed_image.bin'
+        size = compress_image(sys.argv[2], output)
+
+        print('Built compressed image: {0} ({1} bytes)'.format(output, size))
+        return
+
+    # Build a delta image: update_image.py delta <base_image> <target_image> [output]
+    if len(sys.argv) > 1 and sys.argv[1] == 'delta':
+        output = sys.argv[4] if len(sys.argv) > 4 else 'delta_image.bin'
+        size = build_delta_image(sys.argv[2], sys.argv[3], output)
+
+        print('Built delta image: {0} ({1} bytes)'.format(output, size))
+        return
+
     # Get input files from args
     inputs = sys.argv[1:]
     print('Inputs: {0}'.format(inputs))